@@ -165,6 +165,16 @@ header file. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* run time stats count core cycles, print_stats() shows the cpu share of every task over the last second */
+#define configGENERATE_RUN_TIME_STATS            1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS   configureTimerForRunTimeStats
+#define portGET_RUN_TIME_COUNTER_VALUE           getRunTimeCounterValue
+/* index 1 wakes the spi task for work, see SQ_NOTIFY_INDEX, index 0 ends its transfers */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES    2
+#if defined(__ICCARM__) || defined(__ARMCC_VERSION) || defined(__GNUC__)
+void configureTimerForRunTimeStats(void);
+unsigned long getRunTimeCounterValue(void);
+#endif
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,666 @@
+/**
+ * @file crcTables.h
+ * @brief const crc tables of the named crc configurations, generated by crctablegen.c, do not edit
+ * @note - included by spiqueue.c only, regenerate with the crctables target of the justbuffer project
+ * @note - copy the regenerated file to stm_code/ems_rtos/core/inc as well, firmware and host share the tables
+ */
+
+#ifndef CRCTABLES_H
+#define CRCTABLES_H
+
+// clang-format off
+/** @brief crc-16/xmodem, the crc of the spi link and of mx_crc_init() */
+const struct structCrcData crcXmodem16 = {
+	.config = {16, 0x1021, 0x0000, 0x0000, false, false, 8},
+	.automatic = {
+		.bitLengthMask = 0x0000FFFF,
+		.lookUpTable = {
+			0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+			0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+			0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+			0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+			0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+			0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+			0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+			0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+			0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+			0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+			0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+			0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+			0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+			0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+			0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+			0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+		},
+		.reflectTable = {
+			0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+			0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+			0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+			0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+			0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+			0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+			0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+			0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+			0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+			0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+			0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+			0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+			0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+			0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+			0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+			0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF,
+		},
+		.sliceTable = {
+			{
+				0x00000000, 0x10210000, 0x20420000, 0x30630000, 0x40840000, 0x50A50000, 0x60C60000, 0x70E70000,
+				0x81080000, 0x91290000, 0xA14A0000, 0xB16B0000, 0xC18C0000, 0xD1AD0000, 0xE1CE0000, 0xF1EF0000,
+				0x12310000, 0x02100000, 0x32730000, 0x22520000, 0x52B50000, 0x42940000, 0x72F70000, 0x62D60000,
+				0x93390000, 0x83180000, 0xB37B0000, 0xA35A0000, 0xD3BD0000, 0xC39C0000, 0xF3FF0000, 0xE3DE0000,
+				0x24620000, 0x34430000, 0x04200000, 0x14010000, 0x64E60000, 0x74C70000, 0x44A40000, 0x54850000,
+				0xA56A0000, 0xB54B0000, 0x85280000, 0x95090000, 0xE5EE0000, 0xF5CF0000, 0xC5AC0000, 0xD58D0000,
+				0x36530000, 0x26720000, 0x16110000, 0x06300000, 0x76D70000, 0x66F60000, 0x56950000, 0x46B40000,
+				0xB75B0000, 0xA77A0000, 0x97190000, 0x87380000, 0xF7DF0000, 0xE7FE0000, 0xD79D0000, 0xC7BC0000,
+				0x48C40000, 0x58E50000, 0x68860000, 0x78A70000, 0x08400000, 0x18610000, 0x28020000, 0x38230000,
+				0xC9CC0000, 0xD9ED0000, 0xE98E0000, 0xF9AF0000, 0x89480000, 0x99690000, 0xA90A0000, 0xB92B0000,
+				0x5AF50000, 0x4AD40000, 0x7AB70000, 0x6A960000, 0x1A710000, 0x0A500000, 0x3A330000, 0x2A120000,
+				0xDBFD0000, 0xCBDC0000, 0xFBBF0000, 0xEB9E0000, 0x9B790000, 0x8B580000, 0xBB3B0000, 0xAB1A0000,
+				0x6CA60000, 0x7C870000, 0x4CE40000, 0x5CC50000, 0x2C220000, 0x3C030000, 0x0C600000, 0x1C410000,
+				0xEDAE0000, 0xFD8F0000, 0xCDEC0000, 0xDDCD0000, 0xAD2A0000, 0xBD0B0000, 0x8D680000, 0x9D490000,
+				0x7E970000, 0x6EB60000, 0x5ED50000, 0x4EF40000, 0x3E130000, 0x2E320000, 0x1E510000, 0x0E700000,
+				0xFF9F0000, 0xEFBE0000, 0xDFDD0000, 0xCFFC0000, 0xBF1B0000, 0xAF3A0000, 0x9F590000, 0x8F780000,
+				0x91880000, 0x81A90000, 0xB1CA0000, 0xA1EB0000, 0xD10C0000, 0xC12D0000, 0xF14E0000, 0xE16F0000,
+				0x10800000, 0x00A10000, 0x30C20000, 0x20E30000, 0x50040000, 0x40250000, 0x70460000, 0x60670000,
+				0x83B90000, 0x93980000, 0xA3FB0000, 0xB3DA0000, 0xC33D0000, 0xD31C0000, 0xE37F0000, 0xF35E0000,
+				0x02B10000, 0x12900000, 0x22F30000, 0x32D20000, 0x42350000, 0x52140000, 0x62770000, 0x72560000,
+				0xB5EA0000, 0xA5CB0000, 0x95A80000, 0x85890000, 0xF56E0000, 0xE54F0000, 0xD52C0000, 0xC50D0000,
+				0x34E20000, 0x24C30000, 0x14A00000, 0x04810000, 0x74660000, 0x64470000, 0x54240000, 0x44050000,
+				0xA7DB0000, 0xB7FA0000, 0x87990000, 0x97B80000, 0xE75F0000, 0xF77E0000, 0xC71D0000, 0xD73C0000,
+				0x26D30000, 0x36F20000, 0x06910000, 0x16B00000, 0x66570000, 0x76760000, 0x46150000, 0x56340000,
+				0xD94C0000, 0xC96D0000, 0xF90E0000, 0xE92F0000, 0x99C80000, 0x89E90000, 0xB98A0000, 0xA9AB0000,
+				0x58440000, 0x48650000, 0x78060000, 0x68270000, 0x18C00000, 0x08E10000, 0x38820000, 0x28A30000,
+				0xCB7D0000, 0xDB5C0000, 0xEB3F0000, 0xFB1E0000, 0x8BF90000, 0x9BD80000, 0xABBB0000, 0xBB9A0000,
+				0x4A750000, 0x5A540000, 0x6A370000, 0x7A160000, 0x0AF10000, 0x1AD00000, 0x2AB30000, 0x3A920000,
+				0xFD2E0000, 0xED0F0000, 0xDD6C0000, 0xCD4D0000, 0xBDAA0000, 0xAD8B0000, 0x9DE80000, 0x8DC90000,
+				0x7C260000, 0x6C070000, 0x5C640000, 0x4C450000, 0x3CA20000, 0x2C830000, 0x1CE00000, 0x0CC10000,
+				0xEF1F0000, 0xFF3E0000, 0xCF5D0000, 0xDF7C0000, 0xAF9B0000, 0xBFBA0000, 0x8FD90000, 0x9FF80000,
+				0x6E170000, 0x7E360000, 0x4E550000, 0x5E740000, 0x2E930000, 0x3EB20000, 0x0ED10000, 0x1EF00000,
+			},
+			{
+				0x00000000, 0x33310000, 0x66620000, 0x55530000, 0xCCC40000, 0xFFF50000, 0xAAA60000, 0x99970000,
+				0x89A90000, 0xBA980000, 0xEFCB0000, 0xDCFA0000, 0x456D0000, 0x765C0000, 0x230F0000, 0x103E0000,
+				0x03730000, 0x30420000, 0x65110000, 0x56200000, 0xCFB70000, 0xFC860000, 0xA9D50000, 0x9AE40000,
+				0x8ADA0000, 0xB9EB0000, 0xECB80000, 0xDF890000, 0x461E0000, 0x752F0000, 0x207C0000, 0x134D0000,
+				0x06E60000, 0x35D70000, 0x60840000, 0x53B50000, 0xCA220000, 0xF9130000, 0xAC400000, 0x9F710000,
+				0x8F4F0000, 0xBC7E0000, 0xE92D0000, 0xDA1C0000, 0x438B0000, 0x70BA0000, 0x25E90000, 0x16D80000,
+				0x05950000, 0x36A40000, 0x63F70000, 0x50C60000, 0xC9510000, 0xFA600000, 0xAF330000, 0x9C020000,
+				0x8C3C0000, 0xBF0D0000, 0xEA5E0000, 0xD96F0000, 0x40F80000, 0x73C90000, 0x269A0000, 0x15AB0000,
+				0x0DCC0000, 0x3EFD0000, 0x6BAE0000, 0x589F0000, 0xC1080000, 0xF2390000, 0xA76A0000, 0x945B0000,
+				0x84650000, 0xB7540000, 0xE2070000, 0xD1360000, 0x48A10000, 0x7B900000, 0x2EC30000, 0x1DF20000,
+				0x0EBF0000, 0x3D8E0000, 0x68DD0000, 0x5BEC0000, 0xC27B0000, 0xF14A0000, 0xA4190000, 0x97280000,
+				0x87160000, 0xB4270000, 0xE1740000, 0xD2450000, 0x4BD20000, 0x78E30000, 0x2DB00000, 0x1E810000,
+				0x0B2A0000, 0x381B0000, 0x6D480000, 0x5E790000, 0xC7EE0000, 0xF4DF0000, 0xA18C0000, 0x92BD0000,
+				0x82830000, 0xB1B20000, 0xE4E10000, 0xD7D00000, 0x4E470000, 0x7D760000, 0x28250000, 0x1B140000,
+				0x08590000, 0x3B680000, 0x6E3B0000, 0x5D0A0000, 0xC49D0000, 0xF7AC0000, 0xA2FF0000, 0x91CE0000,
+				0x81F00000, 0xB2C10000, 0xE7920000, 0xD4A30000, 0x4D340000, 0x7E050000, 0x2B560000, 0x18670000,
+				0x1B980000, 0x28A90000, 0x7DFA0000, 0x4ECB0000, 0xD75C0000, 0xE46D0000, 0xB13E0000, 0x820F0000,
+				0x92310000, 0xA1000000, 0xF4530000, 0xC7620000, 0x5EF50000, 0x6DC40000, 0x38970000, 0x0BA60000,
+				0x18EB0000, 0x2BDA0000, 0x7E890000, 0x4DB80000, 0xD42F0000, 0xE71E0000, 0xB24D0000, 0x817C0000,
+				0x91420000, 0xA2730000, 0xF7200000, 0xC4110000, 0x5D860000, 0x6EB70000, 0x3BE40000, 0x08D50000,
+				0x1D7E0000, 0x2E4F0000, 0x7B1C0000, 0x482D0000, 0xD1BA0000, 0xE28B0000, 0xB7D80000, 0x84E90000,
+				0x94D70000, 0xA7E60000, 0xF2B50000, 0xC1840000, 0x58130000, 0x6B220000, 0x3E710000, 0x0D400000,
+				0x1E0D0000, 0x2D3C0000, 0x786F0000, 0x4B5E0000, 0xD2C90000, 0xE1F80000, 0xB4AB0000, 0x879A0000,
+				0x97A40000, 0xA4950000, 0xF1C60000, 0xC2F70000, 0x5B600000, 0x68510000, 0x3D020000, 0x0E330000,
+				0x16540000, 0x25650000, 0x70360000, 0x43070000, 0xDA900000, 0xE9A10000, 0xBCF20000, 0x8FC30000,
+				0x9FFD0000, 0xACCC0000, 0xF99F0000, 0xCAAE0000, 0x53390000, 0x60080000, 0x355B0000, 0x066A0000,
+				0x15270000, 0x26160000, 0x73450000, 0x40740000, 0xD9E30000, 0xEAD20000, 0xBF810000, 0x8CB00000,
+				0x9C8E0000, 0xAFBF0000, 0xFAEC0000, 0xC9DD0000, 0x504A0000, 0x637B0000, 0x36280000, 0x05190000,
+				0x10B20000, 0x23830000, 0x76D00000, 0x45E10000, 0xDC760000, 0xEF470000, 0xBA140000, 0x89250000,
+				0x991B0000, 0xAA2A0000, 0xFF790000, 0xCC480000, 0x55DF0000, 0x66EE0000, 0x33BD0000, 0x008C0000,
+				0x13C10000, 0x20F00000, 0x75A30000, 0x46920000, 0xDF050000, 0xEC340000, 0xB9670000, 0x8A560000,
+				0x9A680000, 0xA9590000, 0xFC0A0000, 0xCF3B0000, 0x56AC0000, 0x659D0000, 0x30CE0000, 0x03FF0000,
+			},
+			{
+				0x00000000, 0x37300000, 0x6E600000, 0x59500000, 0xDCC00000, 0xEBF00000, 0xB2A00000, 0x85900000,
+				0xA9A10000, 0x9E910000, 0xC7C10000, 0xF0F10000, 0x75610000, 0x42510000, 0x1B010000, 0x2C310000,
+				0x43630000, 0x74530000, 0x2D030000, 0x1A330000, 0x9FA30000, 0xA8930000, 0xF1C30000, 0xC6F30000,
+				0xEAC20000, 0xDDF20000, 0x84A20000, 0xB3920000, 0x36020000, 0x01320000, 0x58620000, 0x6F520000,
+				0x86C60000, 0xB1F60000, 0xE8A60000, 0xDF960000, 0x5A060000, 0x6D360000, 0x34660000, 0x03560000,
+				0x2F670000, 0x18570000, 0x41070000, 0x76370000, 0xF3A70000, 0xC4970000, 0x9DC70000, 0xAAF70000,
+				0xC5A50000, 0xF2950000, 0xABC50000, 0x9CF50000, 0x19650000, 0x2E550000, 0x77050000, 0x40350000,
+				0x6C040000, 0x5B340000, 0x02640000, 0x35540000, 0xB0C40000, 0x87F40000, 0xDEA40000, 0xE9940000,
+				0x1DAD0000, 0x2A9D0000, 0x73CD0000, 0x44FD0000, 0xC16D0000, 0xF65D0000, 0xAF0D0000, 0x983D0000,
+				0xB40C0000, 0x833C0000, 0xDA6C0000, 0xED5C0000, 0x68CC0000, 0x5FFC0000, 0x06AC0000, 0x319C0000,
+				0x5ECE0000, 0x69FE0000, 0x30AE0000, 0x079E0000, 0x820E0000, 0xB53E0000, 0xEC6E0000, 0xDB5E0000,
+				0xF76F0000, 0xC05F0000, 0x990F0000, 0xAE3F0000, 0x2BAF0000, 0x1C9F0000, 0x45CF0000, 0x72FF0000,
+				0x9B6B0000, 0xAC5B0000, 0xF50B0000, 0xC23B0000, 0x47AB0000, 0x709B0000, 0x29CB0000, 0x1EFB0000,
+				0x32CA0000, 0x05FA0000, 0x5CAA0000, 0x6B9A0000, 0xEE0A0000, 0xD93A0000, 0x806A0000, 0xB75A0000,
+				0xD8080000, 0xEF380000, 0xB6680000, 0x81580000, 0x04C80000, 0x33F80000, 0x6AA80000, 0x5D980000,
+				0x71A90000, 0x46990000, 0x1FC90000, 0x28F90000, 0xAD690000, 0x9A590000, 0xC3090000, 0xF4390000,
+				0x3B5A0000, 0x0C6A0000, 0x553A0000, 0x620A0000, 0xE79A0000, 0xD0AA0000, 0x89FA0000, 0xBECA0000,
+				0x92FB0000, 0xA5CB0000, 0xFC9B0000, 0xCBAB0000, 0x4E3B0000, 0x790B0000, 0x205B0000, 0x176B0000,
+				0x78390000, 0x4F090000, 0x16590000, 0x21690000, 0xA4F90000, 0x93C90000, 0xCA990000, 0xFDA90000,
+				0xD1980000, 0xE6A80000, 0xBFF80000, 0x88C80000, 0x0D580000, 0x3A680000, 0x63380000, 0x54080000,
+				0xBD9C0000, 0x8AAC0000, 0xD3FC0000, 0xE4CC0000, 0x615C0000, 0x566C0000, 0x0F3C0000, 0x380C0000,
+				0x143D0000, 0x230D0000, 0x7A5D0000, 0x4D6D0000, 0xC8FD0000, 0xFFCD0000, 0xA69D0000, 0x91AD0000,
+				0xFEFF0000, 0xC9CF0000, 0x909F0000, 0xA7AF0000, 0x223F0000, 0x150F0000, 0x4C5F0000, 0x7B6F0000,
+				0x575E0000, 0x606E0000, 0x393E0000, 0x0E0E0000, 0x8B9E0000, 0xBCAE0000, 0xE5FE0000, 0xD2CE0000,
+				0x26F70000, 0x11C70000, 0x48970000, 0x7FA70000, 0xFA370000, 0xCD070000, 0x94570000, 0xA3670000,
+				0x8F560000, 0xB8660000, 0xE1360000, 0xD6060000, 0x53960000, 0x64A60000, 0x3DF60000, 0x0AC60000,
+				0x65940000, 0x52A40000, 0x0BF40000, 0x3CC40000, 0xB9540000, 0x8E640000, 0xD7340000, 0xE0040000,
+				0xCC350000, 0xFB050000, 0xA2550000, 0x95650000, 0x10F50000, 0x27C50000, 0x7E950000, 0x49A50000,
+				0xA0310000, 0x97010000, 0xCE510000, 0xF9610000, 0x7CF10000, 0x4BC10000, 0x12910000, 0x25A10000,
+				0x09900000, 0x3EA00000, 0x67F00000, 0x50C00000, 0xD5500000, 0xE2600000, 0xBB300000, 0x8C000000,
+				0xE3520000, 0xD4620000, 0x8D320000, 0xBA020000, 0x3F920000, 0x08A20000, 0x51F20000, 0x66C20000,
+				0x4AF30000, 0x7DC30000, 0x24930000, 0x13A30000, 0x96330000, 0xA1030000, 0xF8530000, 0xCF630000,
+			},
+			{
+				0x00000000, 0x76B40000, 0xED680000, 0x9BDC0000, 0xCAF10000, 0xBC450000, 0x27990000, 0x512D0000,
+				0x85C30000, 0xF3770000, 0x68AB0000, 0x1E1F0000, 0x4F320000, 0x39860000, 0xA25A0000, 0xD4EE0000,
+				0x1BA70000, 0x6D130000, 0xF6CF0000, 0x807B0000, 0xD1560000, 0xA7E20000, 0x3C3E0000, 0x4A8A0000,
+				0x9E640000, 0xE8D00000, 0x730C0000, 0x05B80000, 0x54950000, 0x22210000, 0xB9FD0000, 0xCF490000,
+				0x374E0000, 0x41FA0000, 0xDA260000, 0xAC920000, 0xFDBF0000, 0x8B0B0000, 0x10D70000, 0x66630000,
+				0xB28D0000, 0xC4390000, 0x5FE50000, 0x29510000, 0x787C0000, 0x0EC80000, 0x95140000, 0xE3A00000,
+				0x2CE90000, 0x5A5D0000, 0xC1810000, 0xB7350000, 0xE6180000, 0x90AC0000, 0x0B700000, 0x7DC40000,
+				0xA92A0000, 0xDF9E0000, 0x44420000, 0x32F60000, 0x63DB0000, 0x156F0000, 0x8EB30000, 0xF8070000,
+				0x6E9C0000, 0x18280000, 0x83F40000, 0xF5400000, 0xA46D0000, 0xD2D90000, 0x49050000, 0x3FB10000,
+				0xEB5F0000, 0x9DEB0000, 0x06370000, 0x70830000, 0x21AE0000, 0x571A0000, 0xCCC60000, 0xBA720000,
+				0x753B0000, 0x038F0000, 0x98530000, 0xEEE70000, 0xBFCA0000, 0xC97E0000, 0x52A20000, 0x24160000,
+				0xF0F80000, 0x864C0000, 0x1D900000, 0x6B240000, 0x3A090000, 0x4CBD0000, 0xD7610000, 0xA1D50000,
+				0x59D20000, 0x2F660000, 0xB4BA0000, 0xC20E0000, 0x93230000, 0xE5970000, 0x7E4B0000, 0x08FF0000,
+				0xDC110000, 0xAAA50000, 0x31790000, 0x47CD0000, 0x16E00000, 0x60540000, 0xFB880000, 0x8D3C0000,
+				0x42750000, 0x34C10000, 0xAF1D0000, 0xD9A90000, 0x88840000, 0xFE300000, 0x65EC0000, 0x13580000,
+				0xC7B60000, 0xB1020000, 0x2ADE0000, 0x5C6A0000, 0x0D470000, 0x7BF30000, 0xE02F0000, 0x969B0000,
+				0xDD380000, 0xAB8C0000, 0x30500000, 0x46E40000, 0x17C90000, 0x617D0000, 0xFAA10000, 0x8C150000,
+				0x58FB0000, 0x2E4F0000, 0xB5930000, 0xC3270000, 0x920A0000, 0xE4BE0000, 0x7F620000, 0x09D60000,
+				0xC69F0000, 0xB02B0000, 0x2BF70000, 0x5D430000, 0x0C6E0000, 0x7ADA0000, 0xE1060000, 0x97B20000,
+				0x435C0000, 0x35E80000, 0xAE340000, 0xD8800000, 0x89AD0000, 0xFF190000, 0x64C50000, 0x12710000,
+				0xEA760000, 0x9CC20000, 0x071E0000, 0x71AA0000, 0x20870000, 0x56330000, 0xCDEF0000, 0xBB5B0000,
+				0x6FB50000, 0x19010000, 0x82DD0000, 0xF4690000, 0xA5440000, 0xD3F00000, 0x482C0000, 0x3E980000,
+				0xF1D10000, 0x87650000, 0x1CB90000, 0x6A0D0000, 0x3B200000, 0x4D940000, 0xD6480000, 0xA0FC0000,
+				0x74120000, 0x02A60000, 0x997A0000, 0xEFCE0000, 0xBEE30000, 0xC8570000, 0x538B0000, 0x253F0000,
+				0xB3A40000, 0xC5100000, 0x5ECC0000, 0x28780000, 0x79550000, 0x0FE10000, 0x943D0000, 0xE2890000,
+				0x36670000, 0x40D30000, 0xDB0F0000, 0xADBB0000, 0xFC960000, 0x8A220000, 0x11FE0000, 0x674A0000,
+				0xA8030000, 0xDEB70000, 0x456B0000, 0x33DF0000, 0x62F20000, 0x14460000, 0x8F9A0000, 0xF92E0000,
+				0x2DC00000, 0x5B740000, 0xC0A80000, 0xB61C0000, 0xE7310000, 0x91850000, 0x0A590000, 0x7CED0000,
+				0x84EA0000, 0xF25E0000, 0x69820000, 0x1F360000, 0x4E1B0000, 0x38AF0000, 0xA3730000, 0xD5C70000,
+				0x01290000, 0x779D0000, 0xEC410000, 0x9AF50000, 0xCBD80000, 0xBD6C0000, 0x26B00000, 0x50040000,
+				0x9F4D0000, 0xE9F90000, 0x72250000, 0x04910000, 0x55BC0000, 0x23080000, 0xB8D40000, 0xCE600000,
+				0x1A8E0000, 0x6C3A0000, 0xF7E60000, 0x81520000, 0xD07F0000, 0xA6CB0000, 0x3D170000, 0x4BA30000,
+			},
+			{
+				0x00000000, 0xAA510000, 0x44830000, 0xEED20000, 0x89060000, 0x23570000, 0xCD850000, 0x67D40000,
+				0x022D0000, 0xA87C0000, 0x46AE0000, 0xECFF0000, 0x8B2B0000, 0x217A0000, 0xCFA80000, 0x65F90000,
+				0x045A0000, 0xAE0B0000, 0x40D90000, 0xEA880000, 0x8D5C0000, 0x270D0000, 0xC9DF0000, 0x638E0000,
+				0x06770000, 0xAC260000, 0x42F40000, 0xE8A50000, 0x8F710000, 0x25200000, 0xCBF20000, 0x61A30000,
+				0x08B40000, 0xA2E50000, 0x4C370000, 0xE6660000, 0x81B20000, 0x2BE30000, 0xC5310000, 0x6F600000,
+				0x0A990000, 0xA0C80000, 0x4E1A0000, 0xE44B0000, 0x839F0000, 0x29CE0000, 0xC71C0000, 0x6D4D0000,
+				0x0CEE0000, 0xA6BF0000, 0x486D0000, 0xE23C0000, 0x85E80000, 0x2FB90000, 0xC16B0000, 0x6B3A0000,
+				0x0EC30000, 0xA4920000, 0x4A400000, 0xE0110000, 0x87C50000, 0x2D940000, 0xC3460000, 0x69170000,
+				0x11680000, 0xBB390000, 0x55EB0000, 0xFFBA0000, 0x986E0000, 0x323F0000, 0xDCED0000, 0x76BC0000,
+				0x13450000, 0xB9140000, 0x57C60000, 0xFD970000, 0x9A430000, 0x30120000, 0xDEC00000, 0x74910000,
+				0x15320000, 0xBF630000, 0x51B10000, 0xFBE00000, 0x9C340000, 0x36650000, 0xD8B70000, 0x72E60000,
+				0x171F0000, 0xBD4E0000, 0x539C0000, 0xF9CD0000, 0x9E190000, 0x34480000, 0xDA9A0000, 0x70CB0000,
+				0x19DC0000, 0xB38D0000, 0x5D5F0000, 0xF70E0000, 0x90DA0000, 0x3A8B0000, 0xD4590000, 0x7E080000,
+				0x1BF10000, 0xB1A00000, 0x5F720000, 0xF5230000, 0x92F70000, 0x38A60000, 0xD6740000, 0x7C250000,
+				0x1D860000, 0xB7D70000, 0x59050000, 0xF3540000, 0x94800000, 0x3ED10000, 0xD0030000, 0x7A520000,
+				0x1FAB0000, 0xB5FA0000, 0x5B280000, 0xF1790000, 0x96AD0000, 0x3CFC0000, 0xD22E0000, 0x787F0000,
+				0x22D00000, 0x88810000, 0x66530000, 0xCC020000, 0xABD60000, 0x01870000, 0xEF550000, 0x45040000,
+				0x20FD0000, 0x8AAC0000, 0x647E0000, 0xCE2F0000, 0xA9FB0000, 0x03AA0000, 0xED780000, 0x47290000,
+				0x268A0000, 0x8CDB0000, 0x62090000, 0xC8580000, 0xAF8C0000, 0x05DD0000, 0xEB0F0000, 0x415E0000,
+				0x24A70000, 0x8EF60000, 0x60240000, 0xCA750000, 0xADA10000, 0x07F00000, 0xE9220000, 0x43730000,
+				0x2A640000, 0x80350000, 0x6EE70000, 0xC4B60000, 0xA3620000, 0x09330000, 0xE7E10000, 0x4DB00000,
+				0x28490000, 0x82180000, 0x6CCA0000, 0xC69B0000, 0xA14F0000, 0x0B1E0000, 0xE5CC0000, 0x4F9D0000,
+				0x2E3E0000, 0x846F0000, 0x6ABD0000, 0xC0EC0000, 0xA7380000, 0x0D690000, 0xE3BB0000, 0x49EA0000,
+				0x2C130000, 0x86420000, 0x68900000, 0xC2C10000, 0xA5150000, 0x0F440000, 0xE1960000, 0x4BC70000,
+				0x33B80000, 0x99E90000, 0x773B0000, 0xDD6A0000, 0xBABE0000, 0x10EF0000, 0xFE3D0000, 0x546C0000,
+				0x31950000, 0x9BC40000, 0x75160000, 0xDF470000, 0xB8930000, 0x12C20000, 0xFC100000, 0x56410000,
+				0x37E20000, 0x9DB30000, 0x73610000, 0xD9300000, 0xBEE40000, 0x14B50000, 0xFA670000, 0x50360000,
+				0x35CF0000, 0x9F9E0000, 0x714C0000, 0xDB1D0000, 0xBCC90000, 0x16980000, 0xF84A0000, 0x521B0000,
+				0x3B0C0000, 0x915D0000, 0x7F8F0000, 0xD5DE0000, 0xB20A0000, 0x185B0000, 0xF6890000, 0x5CD80000,
+				0x39210000, 0x93700000, 0x7DA20000, 0xD7F30000, 0xB0270000, 0x1A760000, 0xF4A40000, 0x5EF50000,
+				0x3F560000, 0x95070000, 0x7BD50000, 0xD1840000, 0xB6500000, 0x1C010000, 0xF2D30000, 0x58820000,
+				0x3D7B0000, 0x972A0000, 0x79F80000, 0xD3A90000, 0xB47D0000, 0x1E2C0000, 0xF0FE0000, 0x5AAF0000,
+			},
+			{
+				0x00000000, 0x45A00000, 0x8B400000, 0xCEE00000, 0x06A10000, 0x43010000, 0x8DE10000, 0xC8410000,
+				0x0D420000, 0x48E20000, 0x86020000, 0xC3A20000, 0x0BE30000, 0x4E430000, 0x80A30000, 0xC5030000,
+				0x1A840000, 0x5F240000, 0x91C40000, 0xD4640000, 0x1C250000, 0x59850000, 0x97650000, 0xD2C50000,
+				0x17C60000, 0x52660000, 0x9C860000, 0xD9260000, 0x11670000, 0x54C70000, 0x9A270000, 0xDF870000,
+				0x35080000, 0x70A80000, 0xBE480000, 0xFBE80000, 0x33A90000, 0x76090000, 0xB8E90000, 0xFD490000,
+				0x384A0000, 0x7DEA0000, 0xB30A0000, 0xF6AA0000, 0x3EEB0000, 0x7B4B0000, 0xB5AB0000, 0xF00B0000,
+				0x2F8C0000, 0x6A2C0000, 0xA4CC0000, 0xE16C0000, 0x292D0000, 0x6C8D0000, 0xA26D0000, 0xE7CD0000,
+				0x22CE0000, 0x676E0000, 0xA98E0000, 0xEC2E0000, 0x246F0000, 0x61CF0000, 0xAF2F0000, 0xEA8F0000,
+				0x6A100000, 0x2FB00000, 0xE1500000, 0xA4F00000, 0x6CB10000, 0x29110000, 0xE7F10000, 0xA2510000,
+				0x67520000, 0x22F20000, 0xEC120000, 0xA9B20000, 0x61F30000, 0x24530000, 0xEAB30000, 0xAF130000,
+				0x70940000, 0x35340000, 0xFBD40000, 0xBE740000, 0x76350000, 0x33950000, 0xFD750000, 0xB8D50000,
+				0x7DD60000, 0x38760000, 0xF6960000, 0xB3360000, 0x7B770000, 0x3ED70000, 0xF0370000, 0xB5970000,
+				0x5F180000, 0x1AB80000, 0xD4580000, 0x91F80000, 0x59B90000, 0x1C190000, 0xD2F90000, 0x97590000,
+				0x525A0000, 0x17FA0000, 0xD91A0000, 0x9CBA0000, 0x54FB0000, 0x115B0000, 0xDFBB0000, 0x9A1B0000,
+				0x459C0000, 0x003C0000, 0xCEDC0000, 0x8B7C0000, 0x433D0000, 0x069D0000, 0xC87D0000, 0x8DDD0000,
+				0x48DE0000, 0x0D7E0000, 0xC39E0000, 0x863E0000, 0x4E7F0000, 0x0BDF0000, 0xC53F0000, 0x809F0000,
+				0xD4200000, 0x91800000, 0x5F600000, 0x1AC00000, 0xD2810000, 0x97210000, 0x59C10000, 0x1C610000,
+				0xD9620000, 0x9CC20000, 0x52220000, 0x17820000, 0xDFC30000, 0x9A630000, 0x54830000, 0x11230000,
+				0xCEA40000, 0x8B040000, 0x45E40000, 0x00440000, 0xC8050000, 0x8DA50000, 0x43450000, 0x06E50000,
+				0xC3E60000, 0x86460000, 0x48A60000, 0x0D060000, 0xC5470000, 0x80E70000, 0x4E070000, 0x0BA70000,
+				0xE1280000, 0xA4880000, 0x6A680000, 0x2FC80000, 0xE7890000, 0xA2290000, 0x6CC90000, 0x29690000,
+				0xEC6A0000, 0xA9CA0000, 0x672A0000, 0x228A0000, 0xEACB0000, 0xAF6B0000, 0x618B0000, 0x242B0000,
+				0xFBAC0000, 0xBE0C0000, 0x70EC0000, 0x354C0000, 0xFD0D0000, 0xB8AD0000, 0x764D0000, 0x33ED0000,
+				0xF6EE0000, 0xB34E0000, 0x7DAE0000, 0x380E0000, 0xF04F0000, 0xB5EF0000, 0x7B0F0000, 0x3EAF0000,
+				0xBE300000, 0xFB900000, 0x35700000, 0x70D00000, 0xB8910000, 0xFD310000, 0x33D10000, 0x76710000,
+				0xB3720000, 0xF6D20000, 0x38320000, 0x7D920000, 0xB5D30000, 0xF0730000, 0x3E930000, 0x7B330000,
+				0xA4B40000, 0xE1140000, 0x2FF40000, 0x6A540000, 0xA2150000, 0xE7B50000, 0x29550000, 0x6CF50000,
+				0xA9F60000, 0xEC560000, 0x22B60000, 0x67160000, 0xAF570000, 0xEAF70000, 0x24170000, 0x61B70000,
+				0x8B380000, 0xCE980000, 0x00780000, 0x45D80000, 0x8D990000, 0xC8390000, 0x06D90000, 0x43790000,
+				0x867A0000, 0xC3DA0000, 0x0D3A0000, 0x489A0000, 0x80DB0000, 0xC57B0000, 0x0B9B0000, 0x4E3B0000,
+				0x91BC0000, 0xD41C0000, 0x1AFC0000, 0x5F5C0000, 0x971D0000, 0xD2BD0000, 0x1C5D0000, 0x59FD0000,
+				0x9CFE0000, 0xD95E0000, 0x17BE0000, 0x521E0000, 0x9A5F0000, 0xDFFF0000, 0x111F0000, 0x54BF0000,
+			},
+			{
+				0x00000000, 0xB8610000, 0x60E30000, 0xD8820000, 0xC1C60000, 0x79A70000, 0xA1250000, 0x19440000,
+				0x93AD0000, 0x2BCC0000, 0xF34E0000, 0x4B2F0000, 0x526B0000, 0xEA0A0000, 0x32880000, 0x8AE90000,
+				0x377B0000, 0x8F1A0000, 0x57980000, 0xEFF90000, 0xF6BD0000, 0x4EDC0000, 0x965E0000, 0x2E3F0000,
+				0xA4D60000, 0x1CB70000, 0xC4350000, 0x7C540000, 0x65100000, 0xDD710000, 0x05F30000, 0xBD920000,
+				0x6EF60000, 0xD6970000, 0x0E150000, 0xB6740000, 0xAF300000, 0x17510000, 0xCFD30000, 0x77B20000,
+				0xFD5B0000, 0x453A0000, 0x9DB80000, 0x25D90000, 0x3C9D0000, 0x84FC0000, 0x5C7E0000, 0xE41F0000,
+				0x598D0000, 0xE1EC0000, 0x396E0000, 0x810F0000, 0x984B0000, 0x202A0000, 0xF8A80000, 0x40C90000,
+				0xCA200000, 0x72410000, 0xAAC30000, 0x12A20000, 0x0BE60000, 0xB3870000, 0x6B050000, 0xD3640000,
+				0xDDEC0000, 0x658D0000, 0xBD0F0000, 0x056E0000, 0x1C2A0000, 0xA44B0000, 0x7CC90000, 0xC4A80000,
+				0x4E410000, 0xF6200000, 0x2EA20000, 0x96C30000, 0x8F870000, 0x37E60000, 0xEF640000, 0x57050000,
+				0xEA970000, 0x52F60000, 0x8A740000, 0x32150000, 0x2B510000, 0x93300000, 0x4BB20000, 0xF3D30000,
+				0x793A0000, 0xC15B0000, 0x19D90000, 0xA1B80000, 0xB8FC0000, 0x009D0000, 0xD81F0000, 0x607E0000,
+				0xB31A0000, 0x0B7B0000, 0xD3F90000, 0x6B980000, 0x72DC0000, 0xCABD0000, 0x123F0000, 0xAA5E0000,
+				0x20B70000, 0x98D60000, 0x40540000, 0xF8350000, 0xE1710000, 0x59100000, 0x81920000, 0x39F30000,
+				0x84610000, 0x3C000000, 0xE4820000, 0x5CE30000, 0x45A70000, 0xFDC60000, 0x25440000, 0x9D250000,
+				0x17CC0000, 0xAFAD0000, 0x772F0000, 0xCF4E0000, 0xD60A0000, 0x6E6B0000, 0xB6E90000, 0x0E880000,
+				0xABF90000, 0x13980000, 0xCB1A0000, 0x737B0000, 0x6A3F0000, 0xD25E0000, 0x0ADC0000, 0xB2BD0000,
+				0x38540000, 0x80350000, 0x58B70000, 0xE0D60000, 0xF9920000, 0x41F30000, 0x99710000, 0x21100000,
+				0x9C820000, 0x24E30000, 0xFC610000, 0x44000000, 0x5D440000, 0xE5250000, 0x3DA70000, 0x85C60000,
+				0x0F2F0000, 0xB74E0000, 0x6FCC0000, 0xD7AD0000, 0xCEE90000, 0x76880000, 0xAE0A0000, 0x166B0000,
+				0xC50F0000, 0x7D6E0000, 0xA5EC0000, 0x1D8D0000, 0x04C90000, 0xBCA80000, 0x642A0000, 0xDC4B0000,
+				0x56A20000, 0xEEC30000, 0x36410000, 0x8E200000, 0x97640000, 0x2F050000, 0xF7870000, 0x4FE60000,
+				0xF2740000, 0x4A150000, 0x92970000, 0x2AF60000, 0x33B20000, 0x8BD30000, 0x53510000, 0xEB300000,
+				0x61D90000, 0xD9B80000, 0x013A0000, 0xB95B0000, 0xA01F0000, 0x187E0000, 0xC0FC0000, 0x789D0000,
+				0x76150000, 0xCE740000, 0x16F60000, 0xAE970000, 0xB7D30000, 0x0FB20000, 0xD7300000, 0x6F510000,
+				0xE5B80000, 0x5DD90000, 0x855B0000, 0x3D3A0000, 0x247E0000, 0x9C1F0000, 0x449D0000, 0xFCFC0000,
+				0x416E0000, 0xF90F0000, 0x218D0000, 0x99EC0000, 0x80A80000, 0x38C90000, 0xE04B0000, 0x582A0000,
+				0xD2C30000, 0x6AA20000, 0xB2200000, 0x0A410000, 0x13050000, 0xAB640000, 0x73E60000, 0xCB870000,
+				0x18E30000, 0xA0820000, 0x78000000, 0xC0610000, 0xD9250000, 0x61440000, 0xB9C60000, 0x01A70000,
+				0x8B4E0000, 0x332F0000, 0xEBAD0000, 0x53CC0000, 0x4A880000, 0xF2E90000, 0x2A6B0000, 0x920A0000,
+				0x2F980000, 0x97F90000, 0x4F7B0000, 0xF71A0000, 0xEE5E0000, 0x563F0000, 0x8EBD0000, 0x36DC0000,
+				0xBC350000, 0x04540000, 0xDCD60000, 0x64B70000, 0x7DF30000, 0xC5920000, 0x1D100000, 0xA5710000,
+			},
+			{
+				0x00000000, 0x47D30000, 0x8FA60000, 0xC8750000, 0x0F6D0000, 0x48BE0000, 0x80CB0000, 0xC7180000,
+				0x1EDA0000, 0x59090000, 0x917C0000, 0xD6AF0000, 0x11B70000, 0x56640000, 0x9E110000, 0xD9C20000,
+				0x3DB40000, 0x7A670000, 0xB2120000, 0xF5C10000, 0x32D90000, 0x750A0000, 0xBD7F0000, 0xFAAC0000,
+				0x236E0000, 0x64BD0000, 0xACC80000, 0xEB1B0000, 0x2C030000, 0x6BD00000, 0xA3A50000, 0xE4760000,
+				0x7B680000, 0x3CBB0000, 0xF4CE0000, 0xB31D0000, 0x74050000, 0x33D60000, 0xFBA30000, 0xBC700000,
+				0x65B20000, 0x22610000, 0xEA140000, 0xADC70000, 0x6ADF0000, 0x2D0C0000, 0xE5790000, 0xA2AA0000,
+				0x46DC0000, 0x010F0000, 0xC97A0000, 0x8EA90000, 0x49B10000, 0x0E620000, 0xC6170000, 0x81C40000,
+				0x58060000, 0x1FD50000, 0xD7A00000, 0x90730000, 0x576B0000, 0x10B80000, 0xD8CD0000, 0x9F1E0000,
+				0xF6D00000, 0xB1030000, 0x79760000, 0x3EA50000, 0xF9BD0000, 0xBE6E0000, 0x761B0000, 0x31C80000,
+				0xE80A0000, 0xAFD90000, 0x67AC0000, 0x207F0000, 0xE7670000, 0xA0B40000, 0x68C10000, 0x2F120000,
+				0xCB640000, 0x8CB70000, 0x44C20000, 0x03110000, 0xC4090000, 0x83DA0000, 0x4BAF0000, 0x0C7C0000,
+				0xD5BE0000, 0x926D0000, 0x5A180000, 0x1DCB0000, 0xDAD30000, 0x9D000000, 0x55750000, 0x12A60000,
+				0x8DB80000, 0xCA6B0000, 0x021E0000, 0x45CD0000, 0x82D50000, 0xC5060000, 0x0D730000, 0x4AA00000,
+				0x93620000, 0xD4B10000, 0x1CC40000, 0x5B170000, 0x9C0F0000, 0xDBDC0000, 0x13A90000, 0x547A0000,
+				0xB00C0000, 0xF7DF0000, 0x3FAA0000, 0x78790000, 0xBF610000, 0xF8B20000, 0x30C70000, 0x77140000,
+				0xAED60000, 0xE9050000, 0x21700000, 0x66A30000, 0xA1BB0000, 0xE6680000, 0x2E1D0000, 0x69CE0000,
+				0xFD810000, 0xBA520000, 0x72270000, 0x35F40000, 0xF2EC0000, 0xB53F0000, 0x7D4A0000, 0x3A990000,
+				0xE35B0000, 0xA4880000, 0x6CFD0000, 0x2B2E0000, 0xEC360000, 0xABE50000, 0x63900000, 0x24430000,
+				0xC0350000, 0x87E60000, 0x4F930000, 0x08400000, 0xCF580000, 0x888B0000, 0x40FE0000, 0x072D0000,
+				0xDEEF0000, 0x993C0000, 0x51490000, 0x169A0000, 0xD1820000, 0x96510000, 0x5E240000, 0x19F70000,
+				0x86E90000, 0xC13A0000, 0x094F0000, 0x4E9C0000, 0x89840000, 0xCE570000, 0x06220000, 0x41F10000,
+				0x98330000, 0xDFE00000, 0x17950000, 0x50460000, 0x975E0000, 0xD08D0000, 0x18F80000, 0x5F2B0000,
+				0xBB5D0000, 0xFC8E0000, 0x34FB0000, 0x73280000, 0xB4300000, 0xF3E30000, 0x3B960000, 0x7C450000,
+				0xA5870000, 0xE2540000, 0x2A210000, 0x6DF20000, 0xAAEA0000, 0xED390000, 0x254C0000, 0x629F0000,
+				0x0B510000, 0x4C820000, 0x84F70000, 0xC3240000, 0x043C0000, 0x43EF0000, 0x8B9A0000, 0xCC490000,
+				0x158B0000, 0x52580000, 0x9A2D0000, 0xDDFE0000, 0x1AE60000, 0x5D350000, 0x95400000, 0xD2930000,
+				0x36E50000, 0x71360000, 0xB9430000, 0xFE900000, 0x39880000, 0x7E5B0000, 0xB62E0000, 0xF1FD0000,
+				0x283F0000, 0x6FEC0000, 0xA7990000, 0xE04A0000, 0x27520000, 0x60810000, 0xA8F40000, 0xEF270000,
+				0x70390000, 0x37EA0000, 0xFF9F0000, 0xB84C0000, 0x7F540000, 0x38870000, 0xF0F20000, 0xB7210000,
+				0x6EE30000, 0x29300000, 0xE1450000, 0xA6960000, 0x618E0000, 0x265D0000, 0xEE280000, 0xA9FB0000,
+				0x4D8D0000, 0x0A5E0000, 0xC22B0000, 0x85F80000, 0x42E00000, 0x05330000, 0xCD460000, 0x8A950000,
+				0x53570000, 0x14840000, 0xDCF10000, 0x9B220000, 0x5C3A0000, 0x1BE90000, 0xD39C0000, 0x944F0000,
+			},
+		},
+	},
+};
+
+/** @brief crc-32/iso-hdlc, reflected, for host side logs and captures */
+const struct structCrcData crcIsoHdlc32 = {
+	.config = {32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, true, 8},
+	.automatic = {
+		.bitLengthMask = 0xFFFFFFFF,
+		.lookUpTable = {
+			0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+			0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+			0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+			0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+			0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+			0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+			0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+			0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+			0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+			0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+			0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+			0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+			0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+			0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+			0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+			0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+			0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+			0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+			0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+			0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+			0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+			0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+			0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+			0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+			0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+			0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+			0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+			0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+			0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+			0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+			0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+			0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+		},
+		.reflectTable = {
+			0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+			0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+			0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+			0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+			0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+			0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+			0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+			0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+			0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+			0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+			0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+			0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+			0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+			0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+			0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+			0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF,
+		},
+		.sliceTable = {
+			{
+				0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+				0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+				0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+				0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+				0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+				0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+				0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+				0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+				0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+				0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+				0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+				0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+				0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+				0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+				0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+				0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+				0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+				0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+				0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+				0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+				0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+				0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+				0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+				0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+				0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+				0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+				0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+				0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+				0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+				0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+				0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+				0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+			},
+			{
+				0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+				0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+				0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+				0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+				0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+				0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+				0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+				0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+				0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+				0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+				0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+				0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+				0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+				0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+				0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+				0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+				0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+				0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+				0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+				0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+				0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+				0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+				0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+				0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+				0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+				0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+				0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+				0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+				0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+				0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+				0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+				0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72,
+			},
+			{
+				0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+				0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+				0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+				0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+				0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+				0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+				0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+				0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+				0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+				0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+				0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+				0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+				0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+				0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+				0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+				0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+				0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+				0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+				0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+				0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+				0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+				0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+				0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+				0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+				0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+				0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+				0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+				0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+				0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+				0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+				0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+				0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED,
+			},
+			{
+				0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+				0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+				0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+				0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+				0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+				0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+				0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+				0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+				0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+				0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+				0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+				0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+				0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+				0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+				0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+				0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+				0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+				0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+				0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+				0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+				0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+				0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+				0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+				0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+				0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+				0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+				0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+				0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+				0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+				0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+				0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+				0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1,
+			},
+			{
+				0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+				0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+				0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+				0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+				0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+				0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+				0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+				0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+				0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+				0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+				0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+				0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+				0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+				0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+				0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+				0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+				0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+				0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+				0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+				0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+				0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+				0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+				0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+				0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+				0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+				0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+				0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+				0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+				0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+				0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+				0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+				0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C,
+			},
+			{
+				0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+				0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+				0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+				0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+				0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+				0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+				0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+				0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+				0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+				0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+				0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+				0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+				0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+				0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+				0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+				0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+				0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+				0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+				0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+				0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+				0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+				0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+				0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+				0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+				0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+				0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+				0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+				0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+				0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+				0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+				0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+				0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC,
+			},
+			{
+				0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+				0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+				0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+				0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+				0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+				0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+				0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+				0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+				0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+				0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+				0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+				0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+				0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+				0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+				0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+				0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+				0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+				0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+				0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+				0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+				0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+				0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+				0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+				0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+				0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+				0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+				0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+				0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+				0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+				0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+				0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+				0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30,
+			},
+			{
+				0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+				0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+				0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+				0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+				0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+				0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+				0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+				0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+				0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+				0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+				0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+				0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+				0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+				0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+				0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+				0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+				0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+				0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+				0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+				0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+				0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+				0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+				0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+				0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+				0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+				0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+				0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+				0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+				0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+				0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+				0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+				0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6,
+			},
+		},
+	},
+};
+
+// clang-format on
+
+#endif
@@ -8,6 +8,7 @@
 
 // forward declaration "spiQueue.h"
 struct structSpiQueue;
+struct structSpiRecordBox;
 struct structFrame;
 
 #define BATTERY_AMOUNT (2)
@@ -46,25 +47,12 @@ struct structFrame;
 #define TWENTY_PERCENT (0.2f)
 #define TEN_PERCENT (0.1f)
 
-/* outbound identifiers */
-#define SETPOINT_BATTERY1_ID (0xB1)
-#define SETPOINT_BATTERY2_ID (0xB2)
-#define SETPOINT_DG1_ID (0xB3)
-#define SETPOINT_DG2_ID (0xB4)
-#define SETPOINT_OVERLOAD_ID (0xB5)
-#define TEST_LATENCY_ID (0xA9)
-
-/* inbound identifiers */
-#define POWER_BATTERY1_ID (0xC1)
-#define POWER_BATTERY2_ID (0xC2)
-#define SOC_BATTERY1_ID (0xC3)
-#define SOC_BATTERY2_ID (0xC4)
-#define POWER_DG1_ID (0xC5)
-#define POWER_DG2_ID (0xC6)
-#define SFOC_DG1_ID (0xC7)
-#define SFOC_DG2_ID (0xC8)
-#define CURRENT_MODE_ID (0xC9)
-#define TEST_LATENCY_RETURN_ID (0xA9)
+/* identifiers, one per row of SQ_LEXICON in spiQueue.h */
+#define EMS_LEXICON_ID(NAME, EMS_NAME, ID, TYPE, PRIORITY, STRING, UNIT, SCALE, OFFSET, DEADBAND, REFRESH) EMS_NAME = ID,
+enum ems_identifiers {
+	SQ_LEXICON(EMS_LEXICON_ID)
+};
+#define TEST_LATENCY_RETURN_ID TEST_LATENCY_ID
 
 /*macro for array size*/
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
@@ -127,8 +115,8 @@ struct system* construct_sys(void);
 void destroy_sys(struct system* sys);
 void execute_subroutine(struct system* sys);
 void test_fill(struct system* sys);
-void send_setpoints(struct system* sys, struct structSpiQueue* tx_buffer);
-void parse_simulation_data(struct system* sys, struct structPacket* dataframe);
+void send_setpoints(struct system* sys, struct structSpiQueue* tx_buffer, struct structSpiRecordBox* tx_records, bool tx_pairs, struct structSpiFilter* tx_filter, uint32_t now_ms);
+void parse_simulation_data(struct system* sys, uint8_t dataframe[]);
 void rate_limit(void);
 
 // extern struct system* sys;
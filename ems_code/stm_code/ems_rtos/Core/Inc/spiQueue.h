@@ -18,6 +18,7 @@
 #define SPIQUEUE_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -49,45 +50,151 @@
 #define SQ_CRC_SIZE			2  /**< crc size in bytes */
 #define SQ_FRAME_SIZE		11 /**< packet size in bytes minus crc */
 #define SQ_PACKET_SIZE		13 /**< overall packet size */
+#define SQ_SLOT_SIZE		16 /**< largest packet size rounded up to whole words, size of a spiring slot */
+/** @} */
+
+/**
+ * \defgroup group_packet_v2 packet layout v2
+ * @brief 16 byte packet layout with every field naturally aligned, selected by spiformatset()
+ * @note the id keeps sq_id_index and every size but the sequence byte matches the v1 layout
+ * @{
+ */
+#define SQ_V2_SEQUENCE_INDEX	1  /**< byte index of sequence in packet */
+#define SQ_V2_SEQUENCE_SIZE		1  /**< sequence size in bytes */
+#define SQ_V2_ACK_INDEX			2  /**< byte index of ack in packet, halfword aligned */
+#define SQ_V2_PAYLOAD_INDEX		4  /**< byte index of payload in packet, word aligned */
+#define SQ_V2_CRC_INDEX			12 /**< byte index of crc in packet, word aligned, followed by two zero bytes */
+#define SQ_V2_FRAME_SIZE		12 /**< bytes covered by the crc, three whole words */
+#define SQ_V2_PACKET_SIZE		16 /**< overall packet size, four whole words */
+/** @} */
+
+/**
+ * \defgroup group_record record layout
+ * @brief record frames spread a declared set of lexicon values over consecutive packet slots of one transfer
+ * @note fields follow in declared order aligned to their size up to a word, the crc follows the last field on a word boundary
+ * @{
+ */
+#define SQ_RECORD_VERSION_INDEX		1  /**< byte index of the layout version in a record */
+#define SQ_RECORD_SEQUENCE_INDEX	2  /**< byte index of the sequence in a record in formats with a sequence byte, followed by a zero byte */
+#define SQ_RECORD_PAYLOAD_INDEX		4  /**< byte index of the first field in a record, word aligned */
+#define SQ_RECORD_FIELDS_MAX		16 /**< most fields a record may declare */
+#define SQ_RECORD_SIZE_MAX			64 /**< largest record in bytes, padding of its last packet slot included */
+/** @} */
+
+/**
+ * \defgroup group_window retransmit window
+ * @brief bounds of the selective repeat window, frames and records stay in it until the other side echoes their crc
+ * @{
+ */
+#define SQ_WINDOW_SIZE		8  /**< frames and records awaiting an ack at most, the oldest makes room for a new one */
+#define SQ_WINDOW_ACKS		16 /**< crcs of received frames and records waiting to be echoed at most */
+/** @} */
+
+/**
+ * \defgroup group_link link sequence
+ * @brief frames and records carry a rolling sequence in formats with a sequence byte, the receiver counts loss and drops duplicates
+ * @{
+ */
+#define SQ_LINK_HISTORY		128 /**< sequences behind the newest one a receiver keeps track of, older ones count as duplicates */
 /** @} */
 
 /**
  * \defgroup group_ids packet ids
- * @brief ids
- * @note these must correspond with the lexicon in spiqueue.c
+ * @brief lexicon rows: spiqueue name, ems name, id, datatype, priority class, printable name, printable unit, fixed scale, fixed offset, deadband, refresh
+ * @note scale and offset are in thousandths of the unit, a fixed-point count stands for count * scale + offset
+ * @note deadband is in thousandths of the unit and refresh in ms, see spifilterpass(), ids with a refresh of 0 are not filtered
+ * @note every row becomes an id_* constant below, a *_id constant in ems.h and an entry of the lexicon in spiqueue.c
  * @{
  */
-// MISC
-#define ID_FILLER                  0x01  /**< Filler package for empty transfers */
-#define ID_LATENCY                 0xA9  /**< Latency measurement */
-
-// TEST
-#define ID_TEST_UINT8              0xA0  /**< Test variable for uint8_t types */
-#define ID_TEST_UINT16             0xA1  /**< Test variable for uint16_t types */
-#define ID_TEST_UINT32             0xA2  /**< Test variable for uint32_t types */
-#define ID_TEST_SINT8              0xA3  /**< Test variable for int8_t types */
-#define ID_TEST_SINT16             0xA4  /**< Test variable for int16_t types */
-#define ID_TEST_SINT32             0xA5  /**< Test variable for int32_t types */
-#define ID_TEST_FRAC32             0xA6  /**< Test variable for float types */
-#define ID_TEST_FRAC64             0xA7  /**< Test variable for double types */
-#define ID_TEST_BINARY             0xA8  /**< Test variable for bool types */
-
-// OUTBOUND	
-#define ID_SETPOINT_BATTERY_1      0xB1  /**< Battery 1 power setpoint (kW) */
-#define ID_SETPOINT_BATTERY_2      0xB2  /**< Battery 2 power setpoint (kW) */
-#define ID_SETPOINT_DG_1           0xB3  /**< Diesel Generator 1 power setpoint (kW) */
-#define ID_SETPOINT_DG_2           0xB4  /**< Diesel Generator 2 power setpoint (kW) */
-
-// INBOUND
-#define ID_POWER_BATTERY_1         0xC1  /**< Battery 1 actual power (kW) */
-#define ID_POWER_BATTERY_2         0xC2  /**< Battery 2 actual power (kW) */
-#define ID_SOC_BATTERY_1           0xC3  /**< Battery 1 state of charge (%) */
-#define ID_SOC_BATTERY_2           0xC4  /**< Battery 2 state of charge (%) */
-#define ID_POWER_DG_1              0xC5  /**< DG 1 actual power (kW) */
-#define ID_POWER_DG_2              0xC6  /**< DG 2 actual power (kW) */
-#define ID_SFOC_DG_1               0xC7  /**< DG 1 fuel consumption (gr/kWh) */
-#define ID_SFOC_DG_2               0xC8  /**< DG 2 fuel consumption (gr/kWh) */
-#define ID_OPSTATE                 0xC9  /**< System operational state (enum) */
+#define SQ_LEXICON(ENTRY) \
+/* BAD IDs */ \
+	ENTRY(ID_BAD_LOW,				BAD_LOW_ID,				0x00,	X,		SQ_PRIO_LOW,	"X",					"X",		1,		0,		0,		0) \
+	ENTRY(ID_BAD_HIGH,				BAD_HIGH_ID,			0xFF,	X,		SQ_PRIO_LOW,	"X",					"X",		1,		0,		0,		0) \
+/* MISC */ \
+	ENTRY(ID_FILLER,				FILLER_ID,				0x01,	UINT8,	SQ_PRIO_LOW,	"Filler",				"F",		1,		0,		0,		0) \
+	ENTRY(ID_FORMAT,				FORMAT_ID,				0x02,	UINT8,	SQ_PRIO_HIGH,	"Frame format",			"version",	1,		0,		0,		0) \
+	ENTRY(ID_LATENCY,				TEST_LATENCY_ID,		0xA9,	UINT32,	SQ_PRIO_HIGH,	"Test latency",			"100us",	1,		0,		0,		0) \
+/* TEST */ \
+	ENTRY(ID_TEST_UINT8,			TEST_UINT8_ID,			0xA0,	UINT8,	SQ_PRIO_NORMAL,	"Test UINT8",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_UINT16,			TEST_UINT16_ID,			0xA1,	UINT16,	SQ_PRIO_NORMAL,	"Test UINT16",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_UINT32,			TEST_UINT32_ID,			0xA2,	UINT32,	SQ_PRIO_NORMAL,	"Test UINT32",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_SINT8,			TEST_SINT8_ID,			0xA3,	SINT8,	SQ_PRIO_NORMAL,	"Test SINT8",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_SINT16,			TEST_SINT16_ID,			0xA4,	SINT16,	SQ_PRIO_NORMAL,	"Test SINT16",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_SINT32,			TEST_SINT32_ID,			0xA5,	SINT32,	SQ_PRIO_NORMAL,	"Test SINT32",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_FRAC32,			TEST_FRAC32_ID,			0xA6,	FRAC32,	SQ_PRIO_NORMAL,	"Test FRAC32",			"T",		25,		-40000,	0,		0) \
+	ENTRY(ID_TEST_FRAC64,			TEST_FRAC64_ID,			0xA7,	FRAC64,	SQ_PRIO_NORMAL,	"Test FRAC64",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_BINARY,			TEST_BINARY_ID,			0xA8,	BINARY,	SQ_PRIO_NORMAL,	"Test BINARY",			"T",		1,		0,		0,		0) \
+	ENTRY(ID_TEST_FIXED,			TEST_FIXED_ID,			0xAA,	FIXED,	SQ_PRIO_NORMAL,	"Test FIXED",			"T",		1,		0,		0,		0) \
+/* OUTBOUND */ \
+	ENTRY(ID_SETPOINT_BATTERY_1,	SETPOINT_BATTERY1_ID,	0xB1,	FRAC64,	SQ_PRIO_HIGH,	"Setpoint battery 1",	"kW",		100,	0,		100,	100) \
+	ENTRY(ID_SETPOINT_BATTERY_2,	SETPOINT_BATTERY2_ID,	0xB2,	FRAC64,	SQ_PRIO_HIGH,	"Setpoint battery 2",	"kW",		100,	0,		100,	100) \
+	ENTRY(ID_SETPOINT_DG_1,			SETPOINT_DG1_ID,		0xB3,	FRAC64,	SQ_PRIO_HIGH,	"Setpoint DG 1",		"kW",		100,	0,		100,	100) \
+	ENTRY(ID_SETPOINT_DG_2,			SETPOINT_DG2_ID,		0xB4,	FRAC64,	SQ_PRIO_HIGH,	"Setpoint DG 2",		"kW",		100,	0,		100,	100) \
+	ENTRY(ID_SETPOINT_BATTERIES,	SETPOINT_BATTERIES_ID,	0xB7,	FIXED,	SQ_PRIO_HIGH,	"Setpoint batteries",	"kW",		1,		0,		0,		0) \
+	ENTRY(ID_SETPOINT_DGS,			SETPOINT_DGS_ID,		0xB8,	FIXED,	SQ_PRIO_HIGH,	"Setpoint DGs",			"kW",		1,		0,		0,		0) \
+/* INBOUND */ \
+	ENTRY(ID_POWER_BATTERY_1,		POWER_BATTERY1_ID,		0xC1,	FRAC64,	SQ_PRIO_NORMAL,	"Power battery 1",		"kW",		100,	0,		0,		0) \
+	ENTRY(ID_POWER_BATTERY_2,		POWER_BATTERY2_ID,		0xC2,	FRAC64,	SQ_PRIO_NORMAL,	"Power battery 2",		"kW",		100,	0,		0,		0) \
+	ENTRY(ID_SOC_BATTERY_1,			SOC_BATTERY1_ID,		0xC3,	FRAC32,	SQ_PRIO_NORMAL,	"SOC battery 1",		"%%",		1,		0,		0,		0) \
+	ENTRY(ID_SOC_BATTERY_2,			SOC_BATTERY2_ID,		0xC4,	FRAC32,	SQ_PRIO_NORMAL,	"SOC battery 2",		"%%",		1,		0,		0,		0) \
+	ENTRY(ID_POWER_DG_1,			POWER_DG1_ID,			0xC5,	UINT32,	SQ_PRIO_NORMAL,	"Power DG 1",			"kW",		1,		0,		0,		0) \
+	ENTRY(ID_POWER_DG_2,			POWER_DG2_ID,			0xC6,	UINT32,	SQ_PRIO_NORMAL,	"Power DG 2",			"kW",		1,		0,		0,		0) \
+	ENTRY(ID_SFOC_DG_1,				SFOC_DG1_ID,			0xC7,	FRAC32,	SQ_PRIO_NORMAL,	"SFOC 1",				"gr/kWh",	1,		0,		0,		0) \
+	ENTRY(ID_SFOC_DG_2,				SFOC_DG2_ID,			0xC8,	FRAC32,	SQ_PRIO_NORMAL,	"SFOC 2",				"gr/kWh",	1,		0,		0,		0) \
+	ENTRY(ID_OPSTATE,				CURRENT_MODE_ID,		0xC9,	UINT8,	SQ_PRIO_NORMAL,	"OPstate",				"enum",		1,		0,		0,		0) \
+	ENTRY(ID_POWER_BATTERIES,		POWER_BATTERIES_ID,		0xCA,	FIXED,	SQ_PRIO_NORMAL,	"Power batteries",		"kW",		1,		0,		0,		0) \
+/* RECORDS */ \
+	ENTRY(ID_RECORD_SETPOINTS,		RECORD_SETPOINTS_ID,	0xD1,	RECORD,	SQ_PRIO_HIGH,	"Setpoint record",		"R",		1,		0,		0,		0) \
+	ENTRY(ID_RECORD_PLANT,			RECORD_PLANT_ID,		0xD2,	RECORD,	SQ_PRIO_NORMAL,	"Plant record",			"R",		1,		0,		0,		0)
+
+/** @brief turns a lexicon row into an id_* constant */
+#define SQ_LEXICON_ID(NAME, EMS_NAME, ID, TYPE, PRIORITY, STRING, UNIT, SCALE, OFFSET, DEADBAND, REFRESH) NAME = ID,
+
+/** @brief packet ids, generated from sq_lexicon */
+enum spiQueueIds
+{
+	SQ_LEXICON(SQ_LEXICON_ID)
+};
+/** @} */
+
+/**
+ * \defgroup group_records record layouts
+ * @brief record rows: spiqueue name of a lexicon row of datatype record, layout version, field list
+ * @note field lists name lexicon rows in wire order, bump the version of a record whenever its field list changes
+ * @{
+ */
+#define SQ_RECORD_SETPOINTS(FIELD) \
+	FIELD(ID_SETPOINT_BATTERY_1) FIELD(ID_SETPOINT_BATTERY_2) FIELD(ID_SETPOINT_DG_1) FIELD(ID_SETPOINT_DG_2)
+#define SQ_RECORD_PLANT(FIELD) \
+	FIELD(ID_POWER_BATTERY_1) FIELD(ID_POWER_BATTERY_2) FIELD(ID_SOC_BATTERY_1) FIELD(ID_SOC_BATTERY_2) FIELD(ID_POWER_DG_1) \
+	FIELD(ID_POWER_DG_2) FIELD(ID_SFOC_DG_1) FIELD(ID_SFOC_DG_2) FIELD(ID_OPSTATE)
+
+#define SQ_RECORDS(RECORD) \
+	RECORD(ID_RECORD_SETPOINTS,		1,	SQ_RECORD_SETPOINTS) \
+	RECORD(ID_RECORD_PLANT,			1,	SQ_RECORD_PLANT)
+
+/** @brief turns a record row into an index of the spirecordbox */
+#define SQ_RECORDS_INDEX(NAME, VERSION, FIELDS) NAME##_INDEX,
+
+/** @brief record indexes, generated from sq_records */
+enum spiRecordIndexes
+{
+	SQ_RECORDS(SQ_RECORDS_INDEX)
+	SQ_RECORDS_COUNT /**< amount of records */
+};
+/** @} */
+
+/**
+ * \defgroup group_pairs fixed-point pairs
+ * @brief pair rows: spiqueue name of a lexicon row of datatype fixed, first half, second half
+ * @note each half is an int32 count scaled by the scale and offset columns of its own lexicon row
+ * @{
+ */
+#define SQ_PAIRS(PAIR) \
+	PAIR(ID_TEST_FIXED,				ID_TEST_FRAC32,			ID_TEST_FRAC64) \
+	PAIR(ID_SETPOINT_BATTERIES,		ID_SETPOINT_BATTERY_1,	ID_SETPOINT_BATTERY_2) \
+	PAIR(ID_SETPOINT_DGS,			ID_SETPOINT_DG_1,		ID_SETPOINT_DG_2) \
+	PAIR(ID_POWER_BATTERIES,		ID_POWER_BATTERY_1,		ID_POWER_BATTERY_2)
 /** @} */
 // clang-format on
 
@@ -98,14 +205,50 @@
 #define arraysize(arrayArg) (sizeof(arrayArg) / sizeof(arrayArg[0]))
 
 #if VSCODEPROJECT
-/** @brief using software lookup table to calculate crc */
-#define GETCRC(ARRAY) crcCalcFast(&crcData, ARRAY, SQ_FRAME_SIZE)
+/** @brief using the const crc-16/xmodem tables to calculate crc */
+#define GETCRCSIZE(ARRAY, SIZE) crcCalcFast(&crcXmodem16, ARRAY, SIZE)
+/** @brief start a crc-16/xmodem stream in software */
+#define CRCBEGIN(STREAM) crcBegin(STREAM, &crcXmodem16)
+/** @brief feed the next piece into the software stream */
+#define CRCUPDATE(STREAM, ARRAY, SIZE) crcUpdate(STREAM, ARRAY, SIZE)
+/** @brief checksum of everything fed into the software stream */
+#define CRCFINAL(STREAM) crcFinal(STREAM)
+/** @brief using a simulated cycle counter which is advanced by hand */
+#define GETCYCLES() (spiQueueCycles)
+/** @brief the host has no scheduler, a blocked post calls spiqueuewaithook instead and times out without it */
+#define SQ_WAIT(QUEUE, TICKS) (spiQueueWaitHook != NULL && spiQueueWaitHook(QUEUE, TICKS))
+/** @brief the host has no scheduler, there is no task to wake */
+#define SQ_WAKE(TASK)
+/** @brief the host has a single task, any handle other than null will do */
+#define SQ_TASK() ((void *)1)
+/** @brief the host has no scheduler, waking the consumer calls spiqueuenotifyhook instead */
+#define SQ_NOTIFY(TASK) (spiQueueNotifyHook != NULL ? spiQueueNotifyHook(TASK) : (void)0)
 #else
+#include "FreeRTOS.h"
 #include "crc.h"
 #include "stm32h5xx_hal.h"
+#include "task.h"
 extern CRC_HandleTypeDef hcrc;
-/** @brief using hardware peripheral to calculate crc */
-#define GETCRC(ARRAY) HAL_CRC_Calculate(&hcrc, (uint32_t *)ARRAY, SQ_FRAME_SIZE)
+/** @brief using hardware peripheral to calculate crc, the hal feeds it whole words and only a size not divisible by four bytewise */
+#define GETCRCSIZE(ARRAY, SIZE) HAL_CRC_Calculate(&hcrc, (uint32_t *)ARRAY, SIZE)
+/** @brief start a crc stream in the crc peripheral, getcrc() resets the peripheral so it may not run before crcfinal() */
+#define CRCBEGIN(STREAM) ((STREAM)->crcDataPtr = NULL, (STREAM)->checksum = hcrc.Init.InitValue, __HAL_CRC_DR_RESET(&hcrc))
+/** @brief feed the next piece into the crc peripheral */
+#define CRCUPDATE(STREAM, ARRAY, SIZE) ((STREAM)->checksum = HAL_CRC_Accumulate(&hcrc, (uint32_t *)(ARRAY), SIZE))
+/** @brief checksum of everything fed into the crc peripheral */
+#define CRCFINAL(STREAM) ((STREAM)->checksum)
+/** @brief using the dwt cycle counter, which has to be enabled before the first post */
+#define GETCYCLES() (DWT->CYCCNT)
+/** @brief blocks the posting task until spiqueuepacketremove() notifies it or the timeout passes */
+#define SQ_WAIT(QUEUE, TICKS) (ulTaskNotifyTake(pdTRUE, TICKS) > 0)
+/** @brief notifies the task blocked on a full spiqueue */
+#define SQ_WAKE(TASK) xTaskNotifyGive((TaskHandle_t)TASK)
+/** @brief handle of the posting task */
+#define SQ_TASK() ((void *)xTaskGetCurrentTaskHandle())
+/** @brief notification index waking the consumer, index 0 stays with sq_wait and the tasks' own waits */
+#define SQ_NOTIFY_INDEX 1
+/** @brief wakes the consumer task on its own notification index */
+#define SQ_NOTIFY(TASK) xTaskNotifyGiveIndexed((TaskHandle_t)TASK, SQ_NOTIFY_INDEX)
 /** @brief overload macro which will transform into spiqueuepostint or spiqueuepostfrac depending on payloadvaluearg */
 #define spiQueuePost(structSpiQueuePtrArg, identifierArg, payloadValueArg) _Generic((payloadValueArg), \
 	uint8_t: spiQueuePostInt,                                                                          \
@@ -119,6 +262,8 @@ extern CRC_HandleTypeDef hcrc;
 	float: spiQueuePostFrac,                                                                           \
 	double: spiQueuePostFrac)(structSpiQueuePtrArg, identifierArg, payloadValueArg)
 #endif
+/** @brief crc of a frame in the active format */
+#define GETCRC(ARRAY) GETCRCSIZE(ARRAY, spiFormatActive->frameSize)
 
 #if NOPRINT
 /** @brief zeros calls to print() macro */
@@ -138,27 +283,37 @@ enum errorCode
 	ec_crc_length_bad,
 	ec_crc_polynomial_oversized,
 	ec_crc_polynomial_zero,
+	ec_crc_slicing_bad,
 	ec_sq_already_exist,
 	ec_sq_bad_id,
 	ec_sq_doesnt_exist_post,
 	ec_sq_doesnt_exist,
+	ec_sq_format_bad,
 	ec_sq_packet_malloc_failed,
 	ec_sq_full,
 	ec_sq_incorrect_array_length,
 	ec_sq_malloc_failed,
+	ec_sq_mode_bad,
 	// ec_sq_no_packet_exists_get,
 	ec_sq_no_packet_exists,
 	ec_sq_not_implemented,
+	ec_sq_overflow_bad,
 	ec_sq_payload_no_datatype_2,
 	ec_sq_payload_no_datatype,
 	ec_sq_payload_out_of_range_binary,
+	ec_sq_payload_out_of_range_fixed,
 	ec_sq_payload_out_of_range_sint16,
 	ec_sq_payload_out_of_range_sint32,
 	ec_sq_payload_out_of_range_sint8,
 	ec_sq_payload_out_of_range_uint16,
 	ec_sq_payload_out_of_range_uint32,
 	ec_sq_payload_out_of_range_uint8,
-	ec_sq_remove_failed
+	ec_sq_record_bad,
+	ec_sq_remove_failed,
+	ec_sq_ring_size_bad,
+	ec_sq_scheduler_bad,
+	ec_sq_stream_size_bad,
+	ec_sq_window_bad
 };
 
 /** @brief crcdata sub struct containing crc data which to to be manually set crcinit() */
@@ -170,13 +325,16 @@ struct structCrcConfig
 	uint32_t finalXorValue; /**< xor final checksum with this value */
 	bool inputReflected;	/**< reverse bit order of input */
 	bool resultReflected;	/**< reverse bit order of output */
+	uint8_t slicing;		/**< bytes per table step in crccalcfast(), 0 or 1 for bytewise, 4 or 8 for slicing-by-n */
 };
 
 /** @brief crcdata sub struct containing crc data which will be automatically set by crcinit() */
 struct structCrcDataAutomatic
 {
-	uint32_t bitLengthMask;	   /**< mask calculated using bitlength */
-	uint32_t lookUpTable[256]; /**< lookuptable for use with crccalcfast() */
+	uint32_t bitLengthMask;		   /**< mask calculated using bitlength */
+	uint32_t lookUpTable[256];	   /**< lookuptable for use with crccalcfast() */
+	uint8_t reflectTable[256];	   /**< every byte with reversed bit order, replaces the per byte crcreflect() */
+	uint32_t sliceTable[8][256];   /**< slicing-by-n tables, in reflected order for reflected input and shifted to the top bits otherwise */
 };
 
 /**
@@ -191,8 +349,19 @@ struct structCrcData
 
 #if VSCODEPROJECT
 struct structCrcData crcData = {0};
+uint32_t spiQueueCycles = 0;
 #endif
 
+/**
+ * @brief running crc over data handed in pieces, see crcbegin(), crcupdate() and crcfinal()
+ * @note  on st the crcbegin() macro family keeps the running checksum in the crc peripheral instead
+ */
+struct structCrcStream
+{
+	const struct structCrcData *crcDataPtr; /**< config and tables of the stream */
+	uint32_t checksum;						/**< running checksum in the internal order of the kernel */
+};
+
 /**
  * @brief crc value sub struct for converting crcvalue between two uint8[2]s and uint16
  * @note  this approach was taken to minimize endianness mistakes
@@ -212,12 +381,12 @@ struct structCrc
 };
 
 /**
- * @brief placeholder
- * @note  part of frame but not utilized, could potentialy send crc back for ack
+ * @brief ack field of a frame
+ * @note  echoes the crc of a frame or record received intact, 0 when there is nothing to ack, see spiwindowreceive()
  */
 struct structAck
 {
-	union unionCrc returnCrc; /**< crc -> ack_next */
+	union unionCrc returnCrc; /**< crc of the acked frame, 0 for none */
 	bool retrieved;			  /**< placeholder */
 };
 
@@ -242,37 +411,361 @@ union unionPayload
 struct structPacket
 {
 	uint8_t identifier;					/**< a predefined id recorded by the codex used to distinguish variables as they turn abstracted while in spi transfer  */
+	uint8_t sequence;					/**< sequence byte, only on the wire in formats that carry one */
+	uint8_t priority;					/**< priority class from the lexicon */
 	union unionPayload payload;			/**< union of all datatypes holding payload value */
 	struct structCrc crc;				/**< crc value, check flag and good flag*/
 	struct structAck ack;				/**< ack value, retrieved flag */
+	uint32_t timestamp;					/**< getcycles() value when the packet entered the spiqueue */
 	struct structPacket *nextPacketPtr; /**< pointer to the following packet */
 };
 
+/** @brief frame format versions, negotiated with spiformatoffer() and spiformatanswer() */
+enum spiFormatVersions
+{
+	SQ_FORMAT_V1 = 1,			   /**< 13 byte frame, bytewise dma and crc */
+	SQ_FORMAT_V2 = 2,			   /**< 16 byte frame with a sequence byte, wordwise dma and crc */
+	SQ_FORMAT_LATEST = SQ_FORMAT_V2 /**< highest version this side supports */
+};
+
+/** @brief field layout of a frame format, the id sits at sq_id_index in every format */
+struct structSpiFormat
+{
+	uint8_t version;	   /**< version from spiformatversions */
+	uint8_t packetSize;	   /**< overall packet size */
+	uint8_t frameSize;	   /**< bytes covered by the crc */
+	uint8_t sequenceIndex; /**< byte index of sequence in packet */
+	uint8_t sequenceSize;  /**< sequence size in bytes, 0 in formats without one */
+	uint8_t payloadIndex;  /**< byte index of payload in packet */
+	uint8_t ackIndex;	   /**< byte index of ack in packet */
+	uint8_t crcIndex;	   /**< byte index of crc in packet */
+};
+
+/** @brief format of every frame encoded and decoded, selected by spiformatset() */
+extern const struct structSpiFormat *spiFormatActive;
+
+/**
+ * @brief newest record per record id waiting for the next transfer, filled by spirecordpost() and emptied by spirecordget()
+ * @note  a zero initialised spirecordbox is empty, empty it as well when the frame format changes
+ */
+struct structSpiRecordBox
+{
+	uint8_t pendingCount;								  /**< number of records waiting */
+	bool pending[SQ_RECORDS_COUNT];						  /**< record waiting per record index */
+	uint8_t slots[SQ_RECORDS_COUNT];					  /**< packet slots taken by the waiting record */
+	uint32_t overwriteCount;							  /**< records replaced by a newer one before they were sent */
+	void *consumerTaskPtr;								  /**< task woken when a post fills the empty spirecordbox, null when none */
+	uint8_t record[SQ_RECORDS_COUNT][SQ_RECORD_SIZE_MAX]; /**< waiting records in wire layout */
+};
+
+/** @brief frame or record sent and not acked yet */
+struct structSpiWindowEntry
+{
+	uint8_t slots;					   /**< packet slots taken, 0 for a free entry */
+	uint8_t tries;					   /**< transmissions so far */
+	uint16_t crc;					   /**< crc the other side echoes in an ack field */
+	uint32_t sentTick;				   /**< tick of the last transmission */
+	uint8_t array[SQ_RECORD_SIZE_MAX]; /**< frame or record in wire layout, resent byte for byte */
+};
+
+/** @brief counters of a spiwindow */
+struct structSpiWindowMetrics
+{
+	uint32_t tracked;	  /**< frames and records sent for the first time */
+	uint32_t acked;		  /**< entries freed by an ack */
+	uint32_t resent;	  /**< retransmissions */
+	uint32_t superseded;  /**< entries freed by a newer frame of the same id before their ack came */
+	uint32_t expired;	  /**< entries given up after triesmax transmissions or pushed out of a full window */
+	uint32_t acksDropped; /**< received crcs pushed out before they were echoed */
+};
+
+/**
+ * @brief selective repeat window of one link end, created by spiwindowcreate()
+ * @note  new frames go through spiwindowsend(), every received frame through spiwindowreceive(), spiwindowresend() picks up what timed out
+ */
+struct structSpiWindow
+{
+	uint8_t count;										/**< entries awaiting an ack */
+	uint8_t triesMax;									/**< transmissions before an entry is given up */
+	uint32_t timeout;									/**< ticks without an ack before an entry is resent */
+	uint8_t ackCount;									/**< received crcs waiting to be echoed */
+	uint16_t ack[SQ_WINDOW_ACKS];						/**< received crcs in arrival order */
+	struct structSpiWindowEntry entry[SQ_WINDOW_SIZE];	/**< entries in no particular order */
+	struct structSpiWindowMetrics metrics;				/**< counters since creation */
+};
+
+/** @brief counters of the receiving end of a spilink */
+struct structSpiLinkMetrics
+{
+	uint32_t received;	 /**< frames and records with a good crc, duplicates and fillers included */
+	uint32_t lost;		 /**< sequences skipped and not received since */
+	uint32_t duplicated; /**< frames and records with a sequence received before, dropped */
+	uint32_t outOfOrder; /**< frames and records older than the newest one, delivered late */
+	uint32_t crcFailed;	 /**< frames and records whose crc did not match, dropped */
+};
+
+/**
+ * @brief sequence state of one link, both directions, zero initialised
+ * @note  new frames and records are stamped by spilinkstamp(), every received one goes through spilinkreceive()
+ */
+struct structSpiLink
+{
+	uint8_t sequenceNext;				 /**< sequence of the next frame or record stamped */
+	uint8_t sequenceNewest;				 /**< newest sequence received */
+	bool synced;						 /**< a sequence was received, sequencenewest is valid */
+	uint64_t seen[SQ_LINK_HISTORY / 64]; /**< bit n set when sequence sequencenewest - n was received */
+	struct structSpiLinkMetrics metrics; /**< counters since initialisation */
+};
+
+/** @brief what spilinkreceive() makes of a received frame or record */
+enum spiLinkVerdicts
+{
+	SQ_LINK_CRC_FAILED, /**< crc does not match, drop it */
+	SQ_LINK_DUPLICATE,	/**< sequence received before, ack it again but drop it */
+	SQ_LINK_NEW			/**< intact and not seen before, decode it */
+};
+
+/** @brief counters of a spifilter */
+struct structSpiFilterMetrics
+{
+	uint32_t passed; /**< values sent */
+	uint32_t held;	 /**< values held back within their deadband and refresh */
+};
+
+/** @brief turns a lexicon row with a refresh into one filter slot */
+#define SQ_LEXICON_FILTERED(NAME, EMS_NAME, ID, TYPE, PRIORITY, STRING, UNIT, SCALE, OFFSET, DEADBAND, REFRESH) +((REFRESH) != 0)
+
+/** @brief slots of a spifilter, one per lexicon row with a refresh */
+#define SQ_FILTER_SLOTS (0 SQ_LEXICON(SQ_LEXICON_FILTERED))
+
+/**
+ * @brief last sent value per filtered id in front of a spiqueue or spirecordbox, zero initialised
+ * @note  every value passes spifilterpass() before it is posted and spifiltersent() once the post succeeded
+ * @note  deadband and refresh come from the lexicon, an id takes the next free slot when it is sent for the first time
+ */
+struct structSpiFilter
+{
+	uint8_t slots;						   /**< slots taken */
+	uint8_t identifier[SQ_FILTER_SLOTS];   /**< id per taken slot */
+	double value[SQ_FILTER_SLOTS];		   /**< last sent value per slot */
+	uint32_t tick[SQ_FILTER_SLOTS];	   /**< ms of the last sent value per slot */
+	struct structSpiFilterMetrics metrics; /**< counters since initialisation */
+};
+
+/** @brief spiqueue posting modes */
+enum spiQueueModes
+{
+	SQ_MODE_FIFO,	/**< every post appends a packet */
+	SQ_MODE_MAILBOX /**< a post overwrites the pending packet with the same id, holding only the newest value per id */
+};
+
+/** @brief priority classes, selected per id by the priority column of the lexicon */
+enum spiQueuePriorities
+{
+	SQ_PRIO_HIGH,	/**< latency probes and setpoints */
+	SQ_PRIO_NORMAL, /**< default for ids without a lexicon entry */
+	SQ_PRIO_LOW,	/**< filler */
+	SQ_PRIO_CLASSES /**< amount of priority classes */
+};
+
+/** @brief order in which the priority classes are served */
+enum spiQueueSchedulers
+{
+	SQ_SCHEDULER_FIFO,	  /**< priorities are ignored, all packets share the normal class */
+	SQ_SCHEDULER_STRICT,  /**< a lower class is only served when all higher classes are empty */
+	SQ_SCHEDULER_WEIGHTED /**< every class is served up to its weight per round, no class starves */
+};
+
+/** @brief sub queue holding the packets of a single priority class */
+struct structSpiQueueClass
+{
+	struct structPacket *headPacketPtr; /**< pointer to the first packet of this class */
+	struct structPacket *tailPacketPtr; /**< pointer to the last packet of this class */
+	uint8_t sizeCurrent;				/**< number of current packets of this class */
+	uint8_t sizePeak;					/**< highest number of packets of this class seen at once */
+	uint8_t weight;						/**< number of packets this class may send per weighted round */
+	uint8_t credit;						/**< number of packets this class may still send in the current weighted round */
+};
+
+/** @brief what a post does when the spiqueue is full */
+enum spiQueueOverflows
+{
+	SQ_OVERFLOW_DROP_NEWEST, /**< the new frame is rejected */
+	SQ_OVERFLOW_DROP_OLDEST, /**< the oldest packet of the lowest class not above the new frame is dropped */
+	SQ_OVERFLOW_BLOCK		 /**< the posting task waits up to the timeout for a get to make room */
+};
+
+/** @brief reasons for a frame to get lost on its way through the spiqueue */
+enum spiQueueDropReasons
+{
+	SQ_DROP_FULL,	   /**< rejected because the spiqueue was full */
+	SQ_DROP_LENGTH,	   /**< rejected because of an incorrect array length */
+	SQ_DROP_ENCODE,	   /**< rejected because the id or value did not fit the lexicon */
+	SQ_DROP_OVERWRITE, /**< pending value replaced by a newer one in mailbox mode */
+	SQ_DROP_OLDEST,	   /**< pending packet dropped to make room for a newer one */
+	SQ_DROP_TIMEOUT,   /**< rejected because no room was made while the post was blocked */
+	SQ_DROP_REASONS	   /**< amount of drop reasons */
+};
+
+/** @brief health counters of a spiqueue, read with spiqueuemetricsget() and cleared with spiqueuemetricsreset() */
+struct structSpiQueueMetrics
+{
+	uint32_t posts;					 /**< number of accepted frames, mailbox overwrites included */
+	uint32_t gets;					 /**< number of packets that left the spiqueue */
+	uint32_t drops[SQ_DROP_REASONS]; /**< number of lost frames per spiqueuedropreasons */
+	uint32_t blocks;				 /**< number of times a post had to wait for room */
+	uint8_t sizeCurrent;			 /**< number of packets inside the spiqueue, only filled in by spiqueuemetricsget() */
+	uint8_t sizePeak;				 /**< highest number of packets inside the spiqueue at once */
+	uint32_t dwellMin;				 /**< shortest time between post and leave in getcycles() ticks */
+	uint32_t dwellMean;				 /**< mean time between post and leave, only filled in by spiqueuemetricsget() */
+	uint32_t dwellMax;				 /**< longest time between post and leave */
+	uint64_t dwellSum;				 /**< sum of all times between post and leave */
+};
+
 /** @brief structure for making a queue for use with spi. keeps track of last packet address */
 struct structSpiQueue
 {
 	uint8_t sizeCurrent;				/**< number of current packets inside the spiqueue */
 	uint8_t sizeMax;					/**< number of maximum allowed packets inside the spiqueue */
-	struct structPacket *tailPacketPtr; /**< pointer to the last appended packet */
-	struct structPacket *headPacketPtr; /**< pointer to the first appended packet */
+	uint8_t mode;						/**< posting mode from spiqueuemodes */
+	uint8_t scheduler;					/**< class scheduler from spiqueueschedulers */
+	uint8_t overflow;					/**< overflow policy from spiqueueoverflows */
+	uint32_t timeout;					/**< ticks a blocked post waits for room */
+	void *waitingTaskPtr;				/**< task blocked on the full spiqueue, null when none */
+	void *consumerTaskPtr;				/**< task woken when a post fills the empty spiqueue, null when none */
+	struct structPacket *tailPacketPtr; /**< pointer to the last posted packet, null once it left the spiqueue */
+	struct structPacket *headPacketPtr; /**< pointer to the packet that leaves the spiqueue next */
+	struct structPacket *freePacketPtr; /**< pointer to the first unused packet of the packet pool */
+	struct structPacket *poolPacketPtr; /**< pointer to the packet pool of sizemax packets, allocated together with the spiqueue */
+	struct structSpiQueueClass classes[SQ_PRIO_CLASSES]; /**< sub queue per priority class */
+	struct structSpiQueueMetrics metrics;				 /**< health counters */
 };
 
+#if VSCODEPROJECT
+/** @brief stands in for the task notification of the st, returns true when the wait was ended by a get */
+bool (*spiQueueWaitHook)(struct structSpiQueue *structSpiQueuePtrArg, uint32_t timeoutArg) = NULL;
+/** @brief stands in for the task notification waking the consumer of the st */
+void (*spiQueueNotifyHook)(void *taskArg) = NULL;
+#endif
+
+/** @brief single spiring slot holding one frame in wire layout */
+struct structSpiRingSlot
+{
+	uint32_t sequence;			 /**< publication counter telling producers and consumer who owns the slot */
+	uint8_t frame[SQ_SLOT_SIZE]; /**< frame in wire layout, word aligned */
+};
+
+/**
+ * @brief lock free ring of frames for multiple producers and a single consumer
+ * @note  posting is safe from tasks and isrs without mutex or critical section
+ */
+struct structSpiRing
+{
+	uint32_t mask;					   /**< number of slots minus one, the slot count is a power of two */
+	uint32_t head;					   /**< position of the next frame to get, only written by the consumer */
+	uint32_t tail;					   /**< position of the next slot to claim, advanced by the producers */
+	uint32_t dropCount;				   /**< number of frames rejected because the spiring was full */
+	struct structSpiRingSlot *slotPtr; /**< pointer to the slots, allocated together with the spiring */
+};
+
+/**
+ * @brief double buffer of a circular dma, the dma runs over both halves while the consumer works on the finished one
+ * @note  the half and complete callbacks call spistreamhalfdone(), a single consumer takes and gives the halves back
+ */
+struct structSpiStream
+{
+	uint8_t framesHalf;			   /**< frames per half */
+	uint8_t packetSize;			   /**< bytes per frame, from the format active at spistreamcreate() */
+	uint32_t halfSize;			   /**< bytes per half, frameshalf * packetsize */
+	uint32_t completed;			   /**< halves finished by the dma, only written by the callbacks */
+	uint32_t consumed;			   /**< halves given back by the consumer, only written by the consumer */
+	uint32_t overrunCount;		   /**< halves the dma started over before the consumer gave them back */
+	uint8_t filler[SQ_SLOT_SIZE];  /**< filler frame padding a half when the spiqueue runs dry */
+	uint8_t *transmitPtr;		   /**< transmit double buffer of two halves, allocated together with the spistream */
+	uint8_t *receivePtr;		   /**< receive double buffer of two halves, word aligned behind the transmit halves */
+};
+
+/** @brief byte offset of the packet pool behind the spiqueue, rounded up to the payload alignment */
+#define SQ_POOL_OFFSET (((sizeof(struct structSpiQueue) + sizeof(union unionPayload) - 1) / sizeof(union unionPayload)) * sizeof(union unionPayload))
+
 void errorCatcher(uint8_t errorCodeArg);
 void errorReset(void);
 
 int8_t crcInit(struct structCrcData *crcDataArg);
-uint32_t crcCalcSlow(struct structCrcData *crcDataArg, uint8_t arrayArg[], uint8_t arraySizeArg);
-uint32_t crcCalcFast(struct structCrcData *crcDataArg, uint8_t arrayArg[], uint8_t arraySizeArg);
-void crcCalcTablePrint(struct structCrcData *crcDataArg, bool hexOutputArg, bool tableFormatArg);
+uint32_t crcCalcSlow(const struct structCrcData *crcDataArg, uint8_t arrayArg[], uint32_t arraySizeArg);
+uint32_t crcCalcFast(const struct structCrcData *crcDataArg, uint8_t arrayArg[], uint32_t arraySizeArg);
+void crcBegin(struct structCrcStream *streamArg, const struct structCrcData *crcDataArg);
+void crcUpdate(struct structCrcStream *streamArg, uint8_t arrayArg[], uint32_t arraySizeArg);
+uint32_t crcFinal(const struct structCrcStream *streamArg);
+void crcCalcTablePrint(const struct structCrcData *crcDataArg, bool hexOutputArg, bool tableFormatArg);
+
+/** @brief named crc configurations with const tables, generated into crctables.h by crctablegen.c */
+extern const struct structCrcData crcXmodem16;
+extern const struct structCrcData crcIsoHdlc32;
 
 int8_t spiQueueCreate(struct structSpiQueue **structSpiQueuePtrArg, uint8_t sizeMaxArg);
 int8_t spiQueueRemove(struct structSpiQueue **structSpiQueuePtrArg);
+int8_t spiQueueModeSet(struct structSpiQueue *structSpiQueuePtrArg, uint8_t modeArg);
+int8_t spiQueueSchedulerSet(struct structSpiQueue *structSpiQueuePtrArg, uint8_t schedulerArg, const uint8_t weightArg[]);
+int8_t spiQueueOverflowSet(struct structSpiQueue *structSpiQueuePtrArg, uint8_t overflowArg, uint32_t timeoutArg);
+int8_t spiQueueConsumerSet(struct structSpiQueue *structSpiQueuePtrArg, void *taskArg);
+int8_t spiQueueMetricsGet(struct structSpiQueue *structSpiQueuePtrArg, struct structSpiQueueMetrics *metricsArg);
+int8_t spiQueueMetricsReset(struct structSpiQueue *structSpiQueuePtrArg);
 int8_t spiQueuePacketRemove(struct structSpiQueue *structSpiQueuePtrArg);
 int8_t spiQueuePostArray(struct structSpiQueue *structSpiQueuePtrArg, uint8_t arrayArg[], uint8_t arraySizeArg, bool crcCheckArg);
 int8_t spiQueuePostInt(struct structSpiQueue *structSpiQueuePtrArg, uint8_t identifierArg, int64_t payloadValueArg);
 int8_t spiQueuePostFrac(struct structSpiQueue *structSpiQueuePtrArg, uint8_t identifierArg, double payloadValueArg);
+int8_t spiQueuePostMany(struct structSpiQueue *structSpiQueuePtrArg, const uint8_t identifierArg[], const double payloadValueArg[], uint8_t countArg);
 int8_t spiQueueGetArray(struct structSpiQueue *structSpiQueuePtrArg, uint8_t arrayArg[], uint8_t arraySizeArg);
-int8_t spiQueueProcessAck(struct structSpiQueue *spiQueueTransmitPtrArg, struct structSpiQueue *spiQueueReceivePtrArg, bool ignoreAck);
-int8_t spiQueueNoDuplicate(bool *duplicateArg, uint8_t arrayArg[], uint8_t arraySizeArg);
+int16_t spiQueueGetBurst(struct structSpiQueue *structSpiQueuePtrArg, uint8_t arrayArg[], uint8_t maxFramesArg);
+
+int8_t spiRingCreate(struct structSpiRing **structSpiRingPtrArg, uint16_t sizeMaxArg);
+int8_t spiRingRemove(struct structSpiRing **structSpiRingPtrArg);
+uint8_t *spiRingReserve(struct structSpiRing *structSpiRingPtrArg);
+void spiRingCommit(uint8_t frameArg[]);
+int8_t spiRingPostArray(struct structSpiRing *structSpiRingPtrArg, uint8_t arrayArg[], uint8_t arraySizeArg);
+uint8_t *spiRingPeek(struct structSpiRing *structSpiRingPtrArg);
+int8_t spiRingRelease(struct structSpiRing *structSpiRingPtrArg);
+int8_t spiRingGetArray(struct structSpiRing *structSpiRingPtrArg, uint8_t arrayArg[], uint8_t arraySizeArg);
+uint32_t spiRingSizeCurrent(struct structSpiRing *structSpiRingPtrArg);
+
+int8_t spiStreamCreate(struct structSpiStream **structSpiStreamPtrArg, uint8_t framesHalfArg);
+int8_t spiStreamRemove(struct structSpiStream **structSpiStreamPtrArg);
+void spiStreamHalfDone(struct structSpiStream *structSpiStreamPtrArg, uint8_t halfArg);
+uint8_t *spiStreamTake(struct structSpiStream *structSpiStreamPtrArg, uint8_t **transmitArg);
+int16_t spiStreamFill(struct structSpiStream *structSpiStreamPtrArg, uint8_t transmitArg[], struct structSpiQueue *structSpiQueuePtrArg);
+int8_t spiStreamGive(struct structSpiStream *structSpiStreamPtrArg);
+
+int8_t spiFormatSet(uint8_t versionArg);
+void spiFormatOffer(uint8_t arrayArg[], uint8_t versionArg, uint8_t agreedArg);
+int8_t spiFormatAnswer(uint8_t frameArg[], uint8_t versionArg, uint8_t *agreedArg);
+
+uint8_t spiRecordSlots(uint8_t identifierArg);
+int16_t spiRecordEncode(uint8_t arrayArg[], uint8_t identifierArg, const double valuesArg[]);
+int16_t spiRecordDecode(uint8_t recordArg[], uint8_t identifierArg[], union unionPayload valuesArg[]);
+int8_t spiRecordPost(struct structSpiRecordBox *structSpiRecordBoxPtrArg, uint8_t identifierArg, const double valuesArg[]);
+int16_t spiRecordGet(struct structSpiRecordBox *structSpiRecordBoxPtrArg, uint8_t arrayArg[], uint8_t maxSlotsArg);
+
+int8_t spiFixedEncode(uint8_t identifierArg, int64_t milliValueArg, int32_t *countArg);
+int64_t spiFixedDecode(uint8_t identifierArg, int32_t countArg);
+int8_t spiFixedPost(struct structSpiQueue *structSpiQueuePtrArg, uint8_t identifierArg, int64_t firstArg, int64_t secondArg);
+int8_t spiFixedGet(const uint8_t frameArg[], uint8_t identifierArg[], int64_t valuesArg[]);
+
+int8_t spiWindowCreate(struct structSpiWindow **structSpiWindowPtrArg, uint32_t timeoutArg, uint8_t triesMaxArg);
+int8_t spiWindowRemove(struct structSpiWindow **structSpiWindowPtrArg);
+int16_t spiWindowSend(struct structSpiWindow *structSpiWindowPtrArg, uint8_t arrayArg[], uint8_t slotsArg, uint8_t maxSlotsArg, uint32_t tickArg);
+int16_t spiWindowResend(struct structSpiWindow *structSpiWindowPtrArg, uint8_t arrayArg[], uint8_t maxSlotsArg, uint32_t tickArg);
+int8_t spiWindowReceive(struct structSpiWindow *structSpiWindowPtrArg, uint8_t arrayArg[]);
+int8_t spiLinkStamp(struct structSpiLink *structSpiLinkPtrArg, uint8_t arrayArg[], uint8_t slotsArg);
+int8_t spiLinkReceive(struct structSpiLink *structSpiLinkPtrArg, uint8_t arrayArg[]);
+int8_t spiFilterPass(struct structSpiFilter *structSpiFilterPtrArg, const uint8_t identifierArg[], const double valuesArg[], uint8_t countArg, uint32_t tickArg);
+int8_t spiFilterSent(struct structSpiFilter *structSpiFilterPtrArg, const uint8_t identifierArg[], const double valuesArg[], uint8_t countArg, uint32_t tickArg);
+
+uint8_t spiFrameGetId(const uint8_t frameArg[]);
+uint8_t spiFrameGetSequence(const uint8_t frameArg[]);
+union unionPayload spiFrameGetPayload(const uint8_t frameArg[]);
+uint16_t spiFrameGetAck(const uint8_t frameArg[]);
+uint16_t spiFrameGetCrc(const uint8_t frameArg[]);
+bool spiFrameCrcGood(uint8_t frameArg[]);
 
 #endif
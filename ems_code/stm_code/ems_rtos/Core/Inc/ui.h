@@ -19,4 +19,5 @@ struct system* initialize_sys(struct queue* qu);
 void wait_for_ship_data(struct system* sys, struct queue* qu);
 void clear_screen(struct queue* qu);
 void print_stats(struct system* sys, struct queue* qu);
+void print_cpu(struct queue* qu);
 void print_choice_menu(struct queue* qu);
@@ -67,7 +67,74 @@ enum {
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+// 0: received frames are checked and decoded straight from the dma buffer
+// 1: received frames land in spiringreceive, for when a consumer outside the spi task needs them buffered
+#define SPI_RECEIVE_BUFFERED 0
+// 1: one frame per dma transaction, the head is removed before the transfer
+// n: up to n queued frames leave the spiqueue together and share one dma transaction, the receive side bursts along
+#define SPI_BURST_FRAMES 1
 
+// 0: the spi task starts a dma transaction per cycle
+// 1: spi1 clocks without pause over a circular dma double buffer, the task works on one half while the other is in flight
+#define SPI_STREAMING 0
+// 0: the spi task spins on spitransferstate until the transaction ends, for comparing the cpu shares
+// 1: the spi task blocks on a task notification from the complete and error callbacks, the other tasks run meanwhile
+#define SPI_TRANSFER_NOTIFY 1
+// a transaction not ended after this long is aborted and counted as a timeout
+#define SPI_TRANSFER_TIMEOUT_MS 5
+// 0: the spi task transfers every 1 ms, filler frames go out when there is nothing to send
+// 1: the spi task sleeps until sg_rdy rises or a post fills the empty transmit spiqueue, then sends until it is empty
+#define SPI_ON_DEMAND 0
+// frames per half of the streaming double buffer, a half has to outlast the 1 ms the spi task sleeps
+#define SPI_STREAM_FRAMES 48
+// 0: a transaction is encoded, transferred and decoded one after the other
+// 1: two transmit and receive arrays take turns, frame n+1 is encoded and frame n-1 decoded while the dma moves frame n
+#define SPI_PIPELINED 0
+// highest frame format offered to the speedgoat at start up
+// 1: no offers, the link starts right away with the 13 byte frames
+// 2: 16 byte frames moved in whole words, the speedgoat has to answer the format offers, the link stays in format 1 otherwise
+#define SPI_FRAME_FORMAT 1
+// offers sent before the link gives up on an answer and stays in format 1
+#define SPI_FORMAT_ATTEMPTS 100
+// frames in a row failing their crc before a newer format drops back to format 1
+#define SPI_FORMAT_FAILURES 16
+// 0: the setpoints go out as frames, one per setpoint or one per pair with SPI_FIXED_PAIRS
+// 1: the setpoints travel as one record, records take up to four packet slots of a burst and are decoded whole,
+//    the speedgoat has to decode the record ids, it drops them otherwise
+#define SPI_RECORDS 0
+// 0: every setpoint is a frac64 frame of its own
+// 1: the setpoints travel as two fixed-point pair frames, the speedgoat has to decode the pair ids, it drops them otherwise
+#define SPI_FIXED_PAIRS 0
+// 0: a frame lost on the link stays lost, the next setpoint of its id replaces it
+// 1: frames and records are kept until the speedgoat echoes their crc in an ack field, unacked ones go out again after a timeout,
+//    a speedgoat that does not echo crcs gets every frame SPI_ACK_TRIES times
+#define SPI_RELIABLE 0
+// an unacked frame goes out again after this long, the ack of a frame comes back a transaction or two later
+#define SPI_ACK_TIMEOUT_MS 5
+// transmissions of a frame before it is given up and counted as expired
+#define SPI_ACK_TRIES 4
+
+#if SPI_RECEIVE_BUFFERED && SPI_BURST_FRAMES > 1
+#error "a receive burst spans several spiring slots, use SPI_BURST_FRAMES 1 with SPI_RECEIVE_BUFFERED"
+#endif
+#if SPI_ON_DEMAND && SPI_STREAMING
+#error "streaming clocks the link without pause, use SPI_ON_DEMAND 0 with SPI_STREAMING"
+#endif
+#if SPI_RECEIVE_BUFFERED && SPI_STREAMING
+#error "streamed frames are decoded from the double buffer, use SPI_STREAMING 0 with SPI_RECEIVE_BUFFERED"
+#endif
+#if SPI_RECEIVE_BUFFERED && SPI_PIPELINED
+#error "pipelined frames are decoded from the second receive array, use SPI_PIPELINED 0 with SPI_RECEIVE_BUFFERED"
+#endif
+#if SPI_STREAMING && SPI_FRAME_FORMAT > 1
+#error "the streaming halves are laid out before a format is agreed, use SPI_FRAME_FORMAT 1 with SPI_STREAMING"
+#endif
+#if SPI_RECORDS && (SPI_STREAMING || SPI_BURST_FRAMES < 4)
+#error "a record spans up to four packet slots of one transaction, use SPI_RECORDS 0 without bursts of at least four frames"
+#endif
+#if SPI_RELIABLE && (SPI_STREAMING || SPI_BURST_FRAMES < 2)
+#error "resent frames and ack fillers share the transaction with new frames, use SPI_RELIABLE 0 without bursts of at least two frames"
+#endif
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -81,6 +148,8 @@ extern DMA_QListTypeDef UART_Tx_Queue;
 extern DMA_QListTypeDef UART_Rx_Queue;
 extern DMA_QListTypeDef SPI_queue_tx;
 extern DMA_QListTypeDef SPI_queue_rx;
+extern DMA_NodeTypeDef SPI_node_tx;
+extern DMA_NodeTypeDef SPI_node_rx;
 
 struct system* sys = NULL;
 
@@ -92,10 +161,27 @@ volatile uint8_t uartReceiveStatus = UART_RECEIVE_IDLE;
 
 extern uint8_t errorVal;
 struct structSpiQueue* spiQueueTransmit = NULL;
-struct structSpiQueue* spiQueueReceive = NULL;
-ALIGN_32BYTES(uint8_t spiQueueTransmitArray[13]) = {0};
-ALIGN_32BYTES(uint8_t spiQueueReceiveArray[13]) = {0};
+struct structSpiRing* spiRingReceive = NULL;
+struct structSpiStream* spiStreamLink = NULL;
+struct structSpiRecordBox spiRecordTransmit = {0};
+struct structSpiWindow* spiWindowLink = NULL;
+// sequences stamped into the frames going out and counters of the frames coming in
+struct structSpiLink spiLink = {0};
+// last sent setpoints, a setpoint goes out again once it leaves its deadband or its refresh runs out
+struct structSpiFilter spiFilterTransmit = {0};
+// frames and records in a row whose crc did not match, reset by every good one
+uint16_t spiFormatFailures = 0;
+// one pair per transaction in flight, the pipelined task works on the other pair meanwhile, slots fit every frame format
+ALIGN_32BYTES(uint8_t spiQueueTransmitArray[SPI_PIPELINED + 1][SQ_SLOT_SIZE * SPI_BURST_FRAMES]) = {0};
+ALIGN_32BYTES(uint8_t spiQueueReceiveArray[SPI_PIPELINED + 1][SQ_SLOT_SIZE * SPI_BURST_FRAMES]) = {0};
 volatile uint8_t spiTransferState = SPI_TRANSFER_IDLE;
+// frames and transactions on the spi link, cycles from handing the frames to the dma until they are decoded
+uint32_t spiLinkFrames = 0;
+uint32_t spiLinkTransactions = 0;
+uint64_t spiLinkCycles = 0;
+// transactions ended by the error callback or by the timeout, their frames are not decoded
+uint32_t spiLinkErrors = 0;
+uint32_t spiLinkTimeouts = 0;
 
 volatile bool speedGoatReady = false;
 
@@ -104,8 +190,6 @@ uint32_t latencyStored = 0;
 uint32_t counterid = 0;
 uint8_t latencyAnimator = 0;
 
-double test = 0.0;
-
 /* USER CODE END Variables */
 /* Definitions for SPItask */
 osThreadId_t SPItaskHandle;
@@ -145,8 +229,34 @@ void startup_dial();
 void add_to_queue(char* str);
 void prnt_queue();
 void print_full_queue();
+static void spi_receive_frame(uint8_t frame[]);
+static void spi_receive_record(uint8_t record[]);
+static bool spi_transfer(uint8_t* transmit, uint8_t* receive, uint16_t size);
+static void spi_transfer_start(uint8_t* transmit, uint8_t* receive, uint16_t size);
+static bool spi_transfer_wait(void);
+static int16_t spi_encode(uint8_t* transmit, bool filler);
+static TickType_t spi_idle_ticks(void);
+static void spi_decode(uint8_t* receive, int16_t frames);
+static void spi_format_negotiate(void);
+static bool spi_format_fallback(void);
+static void spi_format_switch(uint8_t version);
+static void spi_format_apply(void);
+static void spi_transfer_notify(void);
 /* USER CODE END FunctionPrototypes */
 
+/* USER CODE BEGIN 1 */
+/* Functions needed when configGENERATE_RUN_TIME_STATS is on */
+void configureTimerForRunTimeStats(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+unsigned long getRunTimeCounterValue(void) {
+	// the cycle counter wraps, the per second differences print_stats() takes don't mind
+	return DWT->CYCCNT;
+}
+/* USER CODE END 1 */
+
 /* USER CODE BEGIN 5 */
 void vApplicationMallocFailedHook(void) {
 	while (1)
@@ -196,21 +306,55 @@ void MX_FREERTOS_Init(void) {
 
 	/*spi dma init*/
 	MX_SPI_queue_tx_Config();
+	MX_SPI_queue_rx_Config();
+#if SPI_STREAMING
+	// both channels loop over their single node, the spi runs without a transfer size until it is aborted
+	handle_GPDMA1_Channel7.InitLinkedList.LinkedListMode = DMA_LINKEDLIST_CIRCULAR;
+	handle_GPDMA1_Channel6.InitLinkedList.LinkedListMode = DMA_LINKEDLIST_CIRCULAR;
+	HAL_DMAEx_List_Init(&handle_GPDMA1_Channel7);
+	HAL_DMAEx_List_Init(&handle_GPDMA1_Channel6);
+	HAL_DMAEx_List_SetCircularMode(&SPI_queue_tx);
+	HAL_DMAEx_List_SetCircularMode(&SPI_queue_rx);
+#endif
 	HAL_DMAEx_List_LinkQ(&handle_GPDMA1_Channel7, &SPI_queue_tx);
 	__HAL_LINKDMA(&hspi1, hdmatx, handle_GPDMA1_Channel7);
-	MX_SPI_queue_rx_Config();
 	HAL_DMAEx_List_LinkQ(&handle_GPDMA1_Channel6, &SPI_queue_rx);
 	__HAL_LINKDMA(&hspi1, hdmarx, handle_GPDMA1_Channel6);
 	logprint(LOG_OK, "DMA initialized\r\n", &uart_queue);
 
 	/*spi queue init*/
-	struct structSpiQueue* spiQueueTransmit = NULL;
+	// the cycle counter timestamps packets for the dwell times in the spiqueue metrics
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 	spiQueueCreate(&spiQueueTransmit, 100);
+	// only the newest setpoint per id is sent, a stalled spi link can't build up stale setpoints
+	spiQueueModeSet(spiQueueTransmit, SQ_MODE_MAILBOX);
+	// latency probes and setpoints overtake lower classes, see the priority column of the lexicon
+	spiQueueSchedulerSet(spiQueueTransmit, SQ_SCHEDULER_STRICT, NULL);
+	// under overload the newest setpoints win, the oldest packet of the lowest class makes room
+	spiQueueOverflowSet(spiQueueTransmit, SQ_OVERFLOW_DROP_OLDEST, 0);
+#if SPI_RECEIVE_BUFFERED
+	// received frames stay in wire layout, the dma writes straight into the spiring slots
+	spiRingCreate(&spiRingReceive, 128);
+	if (spiRingReceive == NULL) {
+		spiQueueRemove(&spiQueueTransmit);
+	}
+#endif
+#if SPI_STREAMING
+	spiStreamCreate(&spiStreamLink, SPI_STREAM_FRAMES);
+	if (spiStreamLink == NULL) {
+		spiQueueRemove(&spiQueueTransmit);
+	}
+#endif
+#if SPI_RELIABLE
+	spiWindowCreate(&spiWindowLink, pdMS_TO_TICKS(SPI_ACK_TIMEOUT_MS), SPI_ACK_TRIES);
+	if (spiWindowLink == NULL) {
+		spiQueueRemove(&spiQueueTransmit);
+	}
+#endif
 
-	struct structSpiQueue* spiQueueReceive = NULL;
-	spiQueueCreate(&spiQueueReceive, 100);
-
-	if (spiQueueTransmit == NULL || spiQueueReceive == NULL) {
+	if (spiQueueTransmit == NULL) {
 		logprint(LOG_FAIL, "SPI buffers could not be initialized\r\n", &uart_queue);
 		prnt_queue();
 		while (1)
@@ -301,49 +445,146 @@ void MX_FREERTOS_Init(void) {
 void SPItxrxtask(void *argument)
 {
   /* USER CODE BEGIN SPItask */
+#if SPI_STREAMING
+	// started once, from here on the half and complete callbacks pace the link
+	if (HAL_SPI_TransmitReceive_DMA(&hspi1, spiStreamLink->transmitPtr, spiStreamLink->receivePtr, 2 * spiStreamLink->halfSize) != HAL_OK) {
+		Error_Handler();
+	}
 	for (;;) {
 		HAL_GPIO_WritePin(THREAD_2_GPIO_Port, THREAD_2_Pin, GPIO_PIN_SET);
-		spiTransferState = SPI_TRANSFER_BUSY;
-
-		spiQueueGetArray(spiQueueTransmit, spiQueueTransmitArray, SQ_PACKET_SIZE);
-		if (HAL_SPI_TransmitReceive_DMA(&hspi1, (uint8_t*)spiQueueTransmitArray, (uint8_t*)spiQueueReceiveArray, SQ_PACKET_SIZE) != HAL_OK) {
-			Error_Handler();
+		uint8_t* spiStreamTransmit = NULL;
+		uint8_t* spiStreamReceive;
+		// every finished half is decoded and refilled before the dma wraps around to it
+		while ((spiStreamReceive = spiStreamTake(spiStreamLink, &spiStreamTransmit)) != NULL) {
+			uint32_t spiLinkStart = GETCYCLES();
+			for (uint8_t index = 0; index < spiStreamLink->framesHalf; index++) {
+				spi_receive_frame(spiStreamReceive + index * spiStreamLink->packetSize);
+			}
+			spiStreamFill(spiStreamLink, spiStreamTransmit, spiQueueTransmit);
+			spiStreamGive(spiStreamLink);
+			spiLinkCycles += (uint32_t)(GETCYCLES() - spiLinkStart);
+			spiLinkFrames += spiStreamLink->framesHalf;
+			spiLinkTransactions++;
 		}
-		while (spiTransferState != SPI_TRANSFER_DONE)
-			;
+		HAL_GPIO_WritePin(THREAD_2_GPIO_Port, THREAD_2_Pin, GPIO_PIN_RESET);
+		osDelay(1);
+	}
+#elif SPI_PIPELINED
+	spi_format_negotiate();
+#if SPI_ON_DEMAND
+	// posts by the other tasks wake this task, its own filler posts don't
+	spiQueueConsumerSet(spiQueueTransmit, SQ_TASK());
+	spiRecordTransmit.consumerTaskPtr = SQ_TASK();
+#endif
+	// array pair of the next transaction, frames already encoded into it and frames received into the other pair
+	uint8_t spiPair = 0;
+	int16_t spiFramesEncoded = 0;
+	int16_t spiFramesReceived = 0;
+	for (;;) {
+		if (spi_format_fallback()) {
+			spiFramesEncoded = 0;
+			spiFramesReceived = 0;
+		}
+		HAL_GPIO_WritePin(THREAD_2_GPIO_Port, THREAD_2_Pin, GPIO_PIN_SET);
+		uint32_t spiLinkStart = GETCYCLES();
+		if (spiFramesEncoded == 0) {
+			spiFramesEncoded = spi_encode(spiQueueTransmitArray[spiPair], true);
+		}
+		int16_t spiFrames = spiFramesEncoded;
+		spi_transfer_start(spiQueueTransmitArray[spiPair], spiQueueReceiveArray[spiPair], spiFrames * spiFormatActive->packetSize);
+		// frame n is on the wire, frame n-1 is decoded and frame n+1 encoded from the other pair meanwhile
+		spi_decode(spiQueueReceiveArray[spiPair ^ 1], spiFramesReceived);
+		spiFramesEncoded = spi_encode(spiQueueTransmitArray[spiPair ^ 1], false);
+		spiFramesReceived = spi_transfer_wait() ? spiFrames : 0;
+		spiPair ^= 1;
+		spiLinkCycles += (uint32_t)(GETCYCLES() - spiLinkStart);
+		spiLinkFrames += spiFrames;
+		spiLinkTransactions++;
+		if (spiFramesEncoded > 0) {
+			// the next transaction starts right away, no gap on the link
+			continue;
+		}
+		// nothing left to send, the frames of the last transaction are decoded before the link idles
+		spi_decode(spiQueueReceiveArray[spiPair ^ 1], spiFramesReceived);
+		spiFramesReceived = 0;
+		HAL_GPIO_WritePin(THREAD_2_GPIO_Port, THREAD_2_Pin, GPIO_PIN_RESET);
+#if SPI_ON_DEMAND
+		TickType_t spiIdleTicks = spi_idle_ticks();
+		if (spiQueueTransmit->sizeCurrent == 0 && spiRecordTransmit.pendingCount == 0 && spiIdleTicks > 0) {
+			ulTaskNotifyTakeIndexed(SQ_NOTIFY_INDEX, pdTRUE, spiIdleTicks);
+		}
+#else
+		osDelay(1);
+#endif
+	}
+#else
+	spi_format_negotiate();
+#if SPI_ON_DEMAND
+	// posts by the other tasks wake this task, its own filler posts don't
+	spiQueueConsumerSet(spiQueueTransmit, SQ_TASK());
+	spiRecordTransmit.consumerTaskPtr = SQ_TASK();
+#endif
+	for (;;) {
+		spi_format_fallback();
+		HAL_GPIO_WritePin(THREAD_2_GPIO_Port, THREAD_2_Pin, GPIO_PIN_SET);
+		uint32_t spiLinkStart = GETCYCLES();
 
-		if (spiQueueReceiveArray[0] != 0x00 && spiQueueReceiveArray[0] != 0xFF) {
-			// check if the rx array is the same as last time
-			// if changed put rx array into queue
-			bool noDuplicate = false;
-			spiQueueNoDuplicate(&noDuplicate, spiQueueReceiveArray, SQ_PACKET_SIZE);
-			if (noDuplicate) {
-				spiQueuePostArray(spiQueueReceive, spiQueueReceiveArray, SQ_PACKET_SIZE, true);
+#if SPI_BURST_FRAMES > 1
+		// the single node of spi_queue_tx carries the whole burst
+		int16_t spiFrames = spi_encode(spiQueueTransmitArray[0], true);
+		if (spi_transfer(spiQueueTransmitArray[0], spiQueueReceiveArray[0], spiFrames * spiFormatActive->packetSize)) {
+			spi_decode(spiQueueReceiveArray[0], spiFrames);
+		}
+#else
+		int16_t spiFrames = 1;
+		spiQueueGetArray(spiQueueTransmit, spiQueueTransmitArray[0], spiFormatActive->packetSize);
+		spiLinkStamp(&spiLink, spiQueueTransmitArray[0], 1);
+		// the head leaves before the transfer, posts during the transfer may move headpacketptr to another packet
+		spiQueuePacketRemove(spiQueueTransmit);
+#if SPI_RECEIVE_BUFFERED
+		// receive straight into a spiring slot, a full spiring counts the drop and the frame lands in the scratch array
+		uint8_t* spiReceiveFrame = spiRingReserve(spiRingReceive);
+		bool spiReceiveGood = spi_transfer(spiQueueTransmitArray[0], spiReceiveFrame != NULL ? spiReceiveFrame : spiQueueReceiveArray[0], spiFormatActive->packetSize);
+		if (spiReceiveFrame != NULL) {
+			// a claimed slot has to be committed, a failed transaction hands over an id the decoder skips
+			if (!spiReceiveGood) {
+				spiReceiveFrame[SQ_ID_INDEX] = 0x00;
 			}
+			spiRingCommit(spiReceiveFrame);
 		}
+#else
+		bool spiReceiveGood = spi_transfer(spiQueueTransmitArray[0], spiQueueReceiveArray[0], spiFormatActive->packetSize);
+#endif
 
-		// perform ack, but gutted :(
-		spiQueueProcessAck(spiQueueTransmit, spiQueueReceive, true);
-
-		if (spiQueueReceive->sizeCurrent > 0) {
-			if (spiQueueReceive->headPacketPtr->crc.good == false) {
-				spiQueuePacketRemove(spiQueueReceive);
-			} else {
-				if (spiQueueReceive->headPacketPtr->identifier == 0xA9) {
-					if(spiQueueReceive->headPacketPtr->payload.uint32 == counterid){
-						latencyStored = latency;
-						latencyAnimator = latencyAnimator < 3 ? latencyAnimator + 1 : 0;
-					}
-				} else {
-					parse_simulation_data(sys, spiQueueReceive->headPacketPtr);
-				}
-				spiQueuePacketRemove(spiQueueReceive);
-			}
+#if SPI_RECEIVE_BUFFERED
+		// the head frame is checked and decoded in place, then its slot is handed back
+		uint8_t* frame = spiRingPeek(spiRingReceive);
+		if (frame != NULL) {
+			spi_receive_frame(frame);
+			spiRingRelease(spiRingReceive);
 		}
-		spiTransferState = SPI_TRANSFER_IDLE;
+#else
+		// nothing is copied or allocated, the frame is checked and decoded while it sits in the dma buffer
+		if (spiReceiveGood) {
+			spi_receive_frame(spiQueueReceiveArray[0]);
+		}
+#endif
+#endif
+		spiLinkCycles += (uint32_t)(GETCYCLES() - spiLinkStart);
+		spiLinkFrames += spiFrames;
+		spiLinkTransactions++;
 		HAL_GPIO_WritePin(THREAD_2_GPIO_Port, THREAD_2_Pin, GPIO_PIN_RESET);
+#if SPI_ON_DEMAND
+		// queued frames go out back to back, an empty spiqueue parks the task until sg_rdy, a post or an ack timeout wakes it
+		TickType_t spiIdleTicks = spi_idle_ticks();
+		if (spiQueueTransmit->sizeCurrent == 0 && spiRecordTransmit.pendingCount == 0 && spiIdleTicks > 0) {
+			ulTaskNotifyTakeIndexed(SQ_NOTIFY_INDEX, pdTRUE, spiIdleTicks);
+		}
+#else
 		osDelay(1);
+#endif
 	}
+#endif
   /* USER CODE END SPItask */
 }
 
@@ -387,7 +628,7 @@ void EMScalctask(void *argument)
 		spiQueuePost(spiQueueTransmit, TEST_LATENCY_ID, counterid);
 		if (sys->goat_preference->mode != INIT || sys->goat_preference->mode == 0) {
 			execute_subroutine(sys);
-			send_setpoints(sys, spiQueueTransmit);
+			send_setpoints(sys, spiQueueTransmit, SPI_RECORDS ? &spiRecordTransmit : NULL, SPI_FIXED_PAIRS, &spiFilterTransmit, xTaskGetTickCount() * portTICK_PERIOD_MS);
 			// CHECK IF BAD :(
 		}
 		HAL_GPIO_WritePin(THREAD_1_GPIO_Port, THREAD_1_Pin, GPIO_PIN_RESET);
@@ -400,6 +641,292 @@ void EMScalctask(void *argument)
 /* Private application code --------------------------------------------------*/
 /* USER CODE BEGIN Application */
 
+/**
+ * @brief checks a received frame and decodes it into sys or the latency measurement
+ * @param frame: received frame in wire layout
+ * @retval None
+ */
+static void spi_receive_frame(uint8_t frame[]) {
+	if (spiFrameGetId(frame) == 0x00 || spiFrameGetId(frame) == 0xFF) {
+		return;
+	}
+	int8_t verdict = spiLinkReceive(&spiLink, frame);
+	if (verdict == SQ_LINK_CRC_FAILED) {
+		spiFormatFailures++;
+		return;
+	}
+	spiFormatFailures = 0;
+#if SPI_RELIABLE
+	// a resent frame is acked again, its first ack may have been the one that got lost
+	spiWindowReceive(spiWindowLink, frame);
+#endif
+	// a frame received before is dropped, a repeating value in a new frame is not
+	if (verdict == SQ_LINK_DUPLICATE) {
+		return;
+	}
+	if (spiFrameGetId(frame) == 0xA9) {
+		if (spiFrameGetPayload(frame).uint32 == counterid) {
+			latencyStored = latency;
+			latencyAnimator = latencyAnimator < 3 ? latencyAnimator + 1 : 0;
+		}
+	} else {
+		parse_simulation_data(sys, frame);
+	}
+}
+
+/**
+ * @brief checks a received record and hands every field to the ems as a frame of its own
+ * @param record: record spanning spirecordslots() packet slots
+ * @retval None
+ * @note - all fields are applied before the ems task runs again, so it never sees half a record
+ */
+static void spi_receive_record(uint8_t record[]) {
+	int8_t verdict = spiLinkReceive(&spiLink, record);
+	if (verdict == SQ_LINK_CRC_FAILED) {
+		spiFormatFailures++;
+		return;
+	}
+	spiFormatFailures = 0;
+#if SPI_RELIABLE
+	spiWindowReceive(spiWindowLink, record);
+#endif
+	if (verdict == SQ_LINK_DUPLICATE) {
+		return;
+	}
+	uint8_t ids[SQ_RECORD_FIELDS_MAX];
+	union unionPayload values[SQ_RECORD_FIELDS_MAX];
+	int16_t fields = spiRecordDecode(record, ids, values);
+	for (int16_t field = 0; field < fields; field++) {
+		uint8_t frame[SQ_SLOT_SIZE] = {0};
+		frame[SQ_ID_INDEX] = ids[field];
+		memcpy(frame + spiFormatActive->payloadIndex, values[field].uint8, SQ_PAYLOAD_SIZE);
+		parse_simulation_data(sys, frame);
+	}
+}
+
+/**
+ * @brief runs one spi dma transaction and waits for it to end
+ * @param transmit: frames to send
+ * @param receive: room for the frames coming back
+ * @param size: bytes in each direction
+ * @retval true when the transaction completed, false on a spi error or timeout
+ */
+static bool spi_transfer(uint8_t* transmit, uint8_t* receive, uint16_t size) {
+	spi_transfer_start(transmit, receive, size);
+	return spi_transfer_wait();
+}
+
+/**
+ * @brief starts one spi dma transaction, the caller is free until spi_transfer_wait()
+ * @param transmit: frames to send, untouched until the transaction ends
+ * @param receive: room for the frames coming back
+ * @param size: bytes in each direction
+ * @retval None
+ */
+static void spi_transfer_start(uint8_t* transmit, uint8_t* receive, uint16_t size) {
+#if SPI_TRANSFER_NOTIFY
+	// a notification left over from an aborted transaction must not end this one early
+	ulTaskNotifyTake(pdTRUE, 0);
+#endif
+	spiTransferState = SPI_TRANSFER_BUSY;
+	if (HAL_SPI_TransmitReceive_DMA(&hspi1, transmit, receive, size) != HAL_OK) {
+		Error_Handler();
+	}
+}
+
+/**
+ * @brief waits for the transaction started by spi_transfer_start() to end
+ * @retval true when the transaction completed, false on a spi error or timeout
+ */
+static bool spi_transfer_wait(void) {
+#if SPI_TRANSFER_NOTIFY
+	if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SPI_TRANSFER_TIMEOUT_MS)) == 0) {
+		HAL_SPI_Abort(&hspi1);
+		spiTransferState = SPI_TRANSFER_IDLE;
+		spiLinkTimeouts++;
+		return false;
+	}
+#else
+	while (spiTransferState == SPI_TRANSFER_BUSY)
+		;
+#endif
+	bool done = spiTransferState == SPI_TRANSFER_DONE;
+	if (!done) {
+		spiLinkErrors++;
+	}
+	spiTransferState = SPI_TRANSFER_IDLE;
+	return done;
+}
+
+/**
+ * @brief moves the next queued frames into a transmit array
+ * @param transmit: room for spi_burst_frames frames
+ * @param filler: true to send a filler frame when the spiqueue is empty, so the speedgoat gets to answer
+ * @retval number of frames in the array, 0 when there was nothing to send
+ * @note - with spi_reliable the frames due for a resend lead the array and waiting acks ride along, see spiwindowsend()
+ */
+static int16_t spi_encode(uint8_t* transmit, bool filler) {
+	int16_t resent = 0;
+#if SPI_RELIABLE
+	// frames not acked in time go out again first, byte for byte, the speedgoat echoes the crc they were tracked with
+	resent = spiWindowResend(spiWindowLink, transmit, SPI_BURST_FRAMES, xTaskGetTickCount());
+	resent = resent > 0 ? resent : 0;
+	transmit += resent * spiFormatActive->packetSize;
+	// resent frames and ack fillers give the speedgoat its turn as well
+	filler = filler && resent == 0 && spiWindowLink->ackCount == 0;
+#endif
+	int16_t frames = 0;
+#if SPI_RECORDS
+	// waiting records go first, each one whole in this transaction
+	frames = spiRecordGet(&spiRecordTransmit, transmit, SPI_BURST_FRAMES - resent);
+#endif
+	if (spiQueueTransmit->sizeCurrent == 0 && filler && frames == 0) {
+		spiQueuePostInt(spiQueueTransmit, ID_FILLER, 0x00);
+	}
+	// the frames leave the spiqueue here, posts during a transaction can't touch them
+	int16_t queued = spiQueueGetBurst(spiQueueTransmit, transmit + frames * spiFormatActive->packetSize, SPI_BURST_FRAMES - resent - frames);
+	frames += queued > 0 ? queued : 0;
+	// new frames take the next sequences, resent frames keep theirs
+	spiLinkStamp(&spiLink, transmit, frames);
+#if SPI_RELIABLE
+	frames = spiWindowSend(spiWindowLink, transmit, frames, SPI_BURST_FRAMES - resent, xTaskGetTickCount());
+	frames = frames > 0 ? frames : 0;
+#endif
+	return resent + frames;
+}
+
+/**
+ * @brief ticks the spi task may sleep once the spiqueue and the records are empty
+ * @retval 0 while acks wait to be sent, the ack timeout while frames wait for an ack, portmax_delay otherwise
+ */
+static TickType_t spi_idle_ticks(void) {
+#if SPI_RELIABLE
+	if (spiWindowLink->ackCount > 0) {
+		return 0;
+	}
+	if (spiWindowLink->count > 0) {
+		return pdMS_TO_TICKS(SPI_ACK_TIMEOUT_MS);
+	}
+#endif
+	return portMAX_DELAY;
+}
+
+/**
+ * @brief checks and decodes the frames of a receive array in place
+ * @param receive: frames of a completed transaction
+ * @param frames: number of frames, 0 for a failed transaction
+ * @retval None
+ */
+static void spi_decode(uint8_t* receive, int16_t frames) {
+	for (int16_t index = 0; index < frames;) {
+		uint8_t* frame = receive + index * spiFormatActive->packetSize;
+		uint8_t slots = spiRecordSlots(spiFrameGetId(frame));
+		// a record that would run past the end of the transaction is cut off and dropped
+		if (slots > 0) {
+			if (index + slots <= frames) {
+				spi_receive_record(frame);
+			}
+			index += slots;
+		} else {
+			spi_receive_frame(frame);
+			index++;
+		}
+	}
+}
+
+/**
+ * @brief agrees on a frame format with the speedgoat before the first queued frame goes out
+ * @retval None
+ * @note - both sides send format 1 offers carrying the version they agreed on so far, the link is full duplex
+ * @note - a side switches once the offer it gets back echoes the agreed version, so neither switches on an offer the other never saw
+ * @note - without an echo after spi_format_attempts offers the link stays in format 1, with spi_frame_format 1 no offers go out
+ */
+static void spi_format_negotiate(void) {
+	if (SPI_FRAME_FORMAT == SQ_FORMAT_V1) {
+		// nothing to agree on, the offers would only hold back the first frames
+		return;
+	}
+	uint8_t agreed = 0;
+	for (uint16_t attempt = 0; attempt < SPI_FORMAT_ATTEMPTS; attempt++) {
+		spiFormatOffer(spiQueueTransmitArray[0], SPI_FRAME_FORMAT, agreed);
+		if (spi_transfer(spiQueueTransmitArray[0], spiQueueReceiveArray[0], SQ_PACKET_SIZE) &&
+			spiFormatAnswer(spiQueueReceiveArray[0], SPI_FRAME_FORMAT, &agreed) > 0) {
+			spi_format_switch(agreed);
+			return;
+		}
+		osDelay(1);
+	}
+}
+
+/**
+ * @brief drops back to format 1 once the frames of a newer format keep failing their crc
+ * @retval true when the link dropped back, the frames encoded or received in the old format are stale
+ * @note - called between two transactions, a speedgoat that missed the switch keeps sending format 1 frames that fail every crc
+ */
+static bool spi_format_fallback(void) {
+	if (spiFormatActive->version == SQ_FORMAT_V1 || spiFormatFailures < SPI_FORMAT_FAILURES) {
+		return false;
+	}
+	spi_format_switch(SQ_FORMAT_V1);
+	return true;
+}
+
+/**
+ * @brief switches the link to another frame format
+ * @param version: version from spiformatversions
+ * @retval None
+ * @note - frames queued meanwhile carry the old layout and crc, the ems task posts its setpoints again within 10 ms
+ */
+static void spi_format_switch(uint8_t version) {
+	while (spiQueueTransmit->sizeCurrent > 0) {
+		spiQueuePacketRemove(spiQueueTransmit);
+	}
+	// the consumer stays registered, only the waiting records go
+	memset(spiRecordTransmit.pending, 0, sizeof(spiRecordTransmit.pending));
+	spiRecordTransmit.pendingCount = 0;
+#if SPI_RELIABLE
+	spiWindowLink->count = 0;
+	spiWindowLink->ackCount = 0;
+#endif
+	spiFormatSet(version);
+	spiFormatFailures = 0;
+	spi_format_apply();
+}
+
+/**
+ * @brief sets the dma and spi fifo widths for the frames of the active format
+ * @retval None
+ * @note - frames of a size divisible by four go through the dma in word beats and through the spi fifo four at a time,
+ *         other sizes go byte by byte as set up by mx_spi1_init()
+ * @note - the hal patches only addresses and length of the head nodes, so the data widths are set in the node registers
+ */
+static void spi_format_apply(void) {
+	bool words = spiFormatActive->packetSize % 4 == 0;
+	uint32_t source = words ? DMA_SRC_DATAWIDTH_WORD : DMA_SRC_DATAWIDTH_BYTE;
+	uint32_t destination = words ? DMA_DEST_DATAWIDTH_WORD : DMA_DEST_DATAWIDTH_BYTE;
+	MODIFY_REG(SPI_node_tx.LinkRegisters[NODE_CTR1_DEFAULT_OFFSET], DMA_CTR1_SDW_LOG2 | DMA_CTR1_DDW_LOG2, source | destination);
+	MODIFY_REG(SPI_node_rx.LinkRegisters[NODE_CTR1_DEFAULT_OFFSET], DMA_CTR1_SDW_LOG2 | DMA_CTR1_DDW_LOG2, source | destination);
+	// the hal checks the word alignment of the buffers against these
+	handle_GPDMA1_Channel7.Init.SrcDataWidth = source;
+	handle_GPDMA1_Channel6.Init.DestDataWidth = destination;
+	hspi1.Init.FifoThreshold = words ? SPI_FIFO_THRESHOLD_04DATA : SPI_FIFO_THRESHOLD_01DATA;
+	if (HAL_SPI_Init(&hspi1) != HAL_OK) {
+		Error_Handler();
+	}
+}
+
+/**
+ * @brief wakes the spi task blocked in spi_transfer_wait(), called from the spi callbacks
+ * @retval None
+ */
+static void spi_transfer_notify(void) {
+#if SPI_TRANSFER_NOTIFY
+	BaseType_t higherPriorityTaskWoken = pdFALSE;
+	vTaskNotifyGiveFromISR((TaskHandle_t)SPItaskHandle, &higherPriorityTaskWoken);
+	portYIELD_FROM_ISR(higherPriorityTaskWoken);
+#endif
+}
+
 void add_to_queue(char* str) {
 	enqueue(&uart_queue, str);
 }
@@ -458,18 +985,38 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef* huart) {
 	uartReceiveStatus = UART_RECEIVE_ERROR;
 }
 
+void HAL_SPI_TxRxHalfCpltCallback(SPI_HandleTypeDef* hspi) {
+#if SPI_STREAMING
+	spiStreamHalfDone(spiStreamLink, 0);
+#endif
+}
+
 void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* hspi) {
+#if SPI_STREAMING
+	spiStreamHalfDone(spiStreamLink, 1);
+#else
 	spiTransferState = SPI_TRANSFER_DONE;
+	spi_transfer_notify();
+#endif
 }
 
 void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi) {
 	spiTransferState = SPI_TRANSFER_ERROR;
+	spi_transfer_notify();
 }
 
 void HAL_GPIO_EXTI_Rising_Callback(uint16_t GPIO_Pin) {
 	switch (GPIO_Pin) {
 	case SG_RDY_Pin:
 		speedGoatReady = true;
+#if SPI_ON_DEMAND
+		// the speedgoat has frames waiting, the spi task clocks them out with a filler frame if need be
+		if (SPItaskHandle != NULL) {
+			BaseType_t higherPriorityTaskWoken = pdFALSE;
+			vTaskNotifyGiveIndexedFromISR((TaskHandle_t)SPItaskHandle, SQ_NOTIFY_INDEX, &higherPriorityTaskWoken);
+			portYIELD_FROM_ISR(higherPriorityTaskWoken);
+		}
+#endif
 		break;
 	case USER_BUTTON_Pin:
 		speedGoatReady = true;
@@ -1,4 +1,5 @@
 #include "ems.h"
+#include <math.h>
 #include <stdio.h>
 #include <unistd.h>
 
@@ -167,44 +168,53 @@ void rate_limit(void) {
 	sleep(1);
 }
 
-void parse_simulation_data(struct system* sys, struct structPacket* dataframe) {
+void parse_simulation_data(struct system* sys, uint8_t dataframe[]) {
 
-	/*stm spi functions*/
-	switch (dataframe->identifier) {
+	/*stm spi functions, the payload is only decoded for known ids*/
+	switch (spiFrameGetId(dataframe)) {
 	case POWER_BATTERY1_ID: {
-		sys->power_battery[0] = dataframe->payload.frac64;
+		sys->power_battery[0] = spiFrameGetPayload(dataframe).frac64;
 		break;
 	}
 	case POWER_BATTERY2_ID: {
-		sys->power_battery[1] = dataframe->payload.frac64;
+		sys->power_battery[1] = spiFrameGetPayload(dataframe).frac64;
+		break;
+	}
+	case POWER_BATTERIES_ID: {
+		uint8_t ids[2];
+		int64_t values[2];
+		if (spiFixedGet(dataframe, ids, values) == 0) {
+			sys->power_battery[0] = values[0] / 1000.0;
+			sys->power_battery[1] = values[1] / 1000.0;
+		}
 		break;
 	}
 	case SOC_BATTERY1_ID: {
-		sys->battery_soc[0] = dataframe->payload.frac32;
+		sys->battery_soc[0] = spiFrameGetPayload(dataframe).frac32;
 		break;
 	}
 	case SOC_BATTERY2_ID: {
-		sys->battery_soc[1] = dataframe->payload.frac32;
+		sys->battery_soc[1] = spiFrameGetPayload(dataframe).frac32;
 		break;
 	}
 	case POWER_DG1_ID: {
-		sys->power_dg[0] = dataframe->payload.uint32;
+		sys->power_dg[0] = spiFrameGetPayload(dataframe).uint32;
 		break;
 	}
 	case POWER_DG2_ID: {
-		sys->power_dg[1] = dataframe->payload.uint32;
+		sys->power_dg[1] = spiFrameGetPayload(dataframe).uint32;
 		break;
 	}
 	case SFOC_DG1_ID: {
-		sys->fuel_efficiency[0] = dataframe->payload.frac32;
+		sys->fuel_efficiency[0] = spiFrameGetPayload(dataframe).frac32;
 		break;
 	}
 	case SFOC_DG2_ID: {
-		sys->fuel_efficiency[1] = dataframe->payload.frac32;
+		sys->fuel_efficiency[1] = spiFrameGetPayload(dataframe).frac32;
 		break;
 	}
 	case CURRENT_MODE_ID: {
-		sys->goat_preference->mode = dataframe->payload.uint8[0];
+		sys->goat_preference->mode = spiFrameGetPayload(dataframe).uint8[0];
 		break;
 	}
 	}
@@ -364,33 +374,46 @@ void ready_setpoint(struct system* sys, int ems_state) {
 	}
 }
 
-void send_setpoints(struct system* sys, struct structSpiQueue* tx_buffer) {
-	spiQueuePostFrac(tx_buffer, SETPOINT_BATTERY1_ID, sys->goat_preference->battery_power[0]);
-
-	double test = 0.0;
-
-	if (test > 0  && test < 0.1){
-		HAL_Delay(1);
-	}
-
-
-	if (tx_buffer->tailPacketPtr->payload.frac64 > 0  && tx_buffer->tailPacketPtr->payload.frac64 < 0.1) {
-		spiQueuePacketRemove(tx_buffer);
+void send_setpoints(struct system* sys, struct structSpiQueue* tx_buffer, struct structSpiRecordBox* tx_records, bool tx_pairs, struct structSpiFilter* tx_filter, uint32_t now_ms) {
+	const uint8_t ids[] = {SETPOINT_BATTERY1_ID, SETPOINT_BATTERY2_ID, SETPOINT_DG1_ID, SETPOINT_DG2_ID};
+	const double setpoints[] = {sys->goat_preference->battery_power[0], sys->goat_preference->battery_power[1],
+								sys->goat_preference->dg_power[0], sys->goat_preference->dg_power[1]};
+
+	// the filter only takes setpoints as sent once they are posted, a failed post goes out again the next time
+	// the record carries every setpoint in the order of SQ_RECORD_SETPOINTS, the speedgoat applies them together
+	if (tx_records != NULL) {
+		// one setpoint beyond its deadband or due for a refresh sends the whole record
+		if (spiFilterPass(tx_filter, ids, setpoints, arraysize(ids), now_ms) != 0 && spiRecordPost(tx_records, RECORD_SETPOINTS_ID, setpoints) == 0) {
+			spiFilterSent(tx_filter, ids, setpoints, arraysize(ids), now_ms);
+		}
+		return;
 	}
 
-	spiQueuePostFrac(tx_buffer, SETPOINT_BATTERY2_ID, sys->goat_preference->battery_power[1]);
-	if (tx_buffer->tailPacketPtr->payload.frac64 > 0  && tx_buffer->tailPacketPtr->payload.frac64 < 0.1) {
-		spiQueuePacketRemove(tx_buffer);
+	// the setpoints travel as two fixed-point pairs, scaled to 0.1 kW by the lexicon, a pair goes out when one of its halves is due
+	if (tx_pairs) {
+		const uint8_t pairs[] = {SETPOINT_BATTERIES_ID, SETPOINT_DGS_ID};
+		for (uint8_t i = 0; i < arraysize(pairs); i++) {
+			if (spiFilterPass(tx_filter, ids + 2 * i, setpoints + 2 * i, 2, now_ms) != 0 &&
+				spiFixedPost(tx_buffer, pairs[i], llround(setpoints[2 * i] * 1000), llround(setpoints[2 * i + 1] * 1000)) == 0) {
+				spiFilterSent(tx_filter, ids + 2 * i, setpoints + 2 * i, 2, now_ms);
+			}
+		}
+		return;
 	}
 
-	spiQueuePostFrac(tx_buffer, SETPOINT_DG1_ID, sys->goat_preference->dg_power[0]);
-	if (tx_buffer->tailPacketPtr->payload.frac64 > 0  && tx_buffer->tailPacketPtr->payload.frac64 < 0.1) {
-		spiQueuePacketRemove(tx_buffer);
+	// every setpoint is a frac64 frame of its own, as every speedgoat decodes them, and goes out when it is due itself
+	uint8_t ids_send[arraysize(ids)];
+	double setpoints_send[arraysize(ids)];
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < arraysize(ids); i++) {
+		if (spiFilterPass(tx_filter, ids + i, setpoints + i, 1, now_ms) != 0) {
+			ids_send[count] = ids[i];
+			setpoints_send[count] = setpoints[i];
+			count++;
+		}
 	}
-
-	spiQueuePostFrac(tx_buffer, SETPOINT_DG2_ID, sys->goat_preference->dg_power[1]);
-	if (tx_buffer->tailPacketPtr->payload.frac64 > 0  && tx_buffer->tailPacketPtr->payload.frac64 < 0.1) {
-		spiQueuePacketRemove(tx_buffer);
+	if (count > 0 && spiQueuePostMany(tx_buffer, ids_send, setpoints_send, count) == 0) {
+		spiFilterSent(tx_filter, ids_send, setpoints_send, count, now_ms);
 	}
 }
 
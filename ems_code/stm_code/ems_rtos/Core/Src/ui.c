@@ -6,6 +6,16 @@
 extern struct ship_state_subroutines subroutines[];
 extern uint32_t latencyStored;
 extern uint8_t latencyAnimator;
+extern struct structSpiQueue* spiQueueTransmit;
+extern uint32_t spiLinkFrames;
+extern uint32_t spiLinkTransactions;
+extern uint64_t spiLinkCycles;
+extern uint32_t spiLinkErrors;
+extern uint32_t spiLinkTimeouts;
+extern struct structSpiWindow* spiWindowLink;
+extern struct structSpiLink spiLink;
+extern struct structSpiFilter spiFilterTransmit;
+extern SPI_HandleTypeDef hspi1;
 
 char STRING_KEUS[] =
 	"Which optimization strategy should be used? Type and enter\r\n"
@@ -111,4 +121,85 @@ void print_stats(struct system* sys, struct queue* qu) {
 	memset(to_send, '\0', 150);
 	snprintf(to_send, 150, "Latency:\t\t%12.1fms%c\r\n", ((double)latencyStored/10.0), spinny);
 	enqueue(qu, to_send);
+
+	struct structSpiQueueMetrics metrics;
+	spiQueueMetricsGet(spiQueueTransmit, &metrics);
+	uint32_t cycles_per_us = SystemCoreClock / 1000000;
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "TX queue (peak/max):\t%8u/%u,\tdropped %lu, overwritten %lu\r\n", metrics.sizePeak, spiQueueTransmit->sizeMax, metrics.drops[SQ_DROP_FULL] + metrics.drops[SQ_DROP_OLDEST] + metrics.drops[SQ_DROP_TIMEOUT], metrics.drops[SQ_DROP_OVERWRITE]);
+	enqueue(qu, to_send);
+
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "TX dwell (us):\t\t%12lu,\t%12lu,\t%12lu\r\n", metrics.dwellMin / cycles_per_us, metrics.dwellMean / cycles_per_us, metrics.dwellMax / cycles_per_us);
+	enqueue(qu, to_send);
+
+	// print_stats runs once a second, the frame count since the last call is the link rate
+	static uint32_t link_frames_last = 0;
+	uint32_t link_frames = spiLinkFrames;
+	uint32_t link_transactions = spiLinkTransactions > 0 ? spiLinkTransactions : 1;
+	uint32_t link_frames_total = link_frames > 0 ? link_frames : 1;
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "SPI link:\t\t%8lu frames/s,\t%lu frames/transaction,\t%lu ns/frame\r\n", link_frames - link_frames_last, link_frames / link_transactions, (uint32_t)(spiLinkCycles * 1000 / cycles_per_us / link_frames_total));
+	link_frames_last = link_frames;
+	enqueue(qu, to_send);
+
+	// frames/s the wire allows at the configured prescaler, frames of the agreed format as 8 bit data without idle cycles between them
+	uint32_t wire_hz = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SPI1) / (2u << (hspi1.Init.BaudRatePrescaler >> SPI_CFG1_MBR_Pos));
+	uint32_t wire_frames = wire_hz / (spiFormatActive->packetSize * 8);
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "SPI wire:\t\t%8lu frames/s,\t%lu kHz\r\n", wire_frames, wire_hz / 1000);
+	enqueue(qu, to_send);
+
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "SPI link errors:\t%8lu,\ttimeouts %lu\r\n", spiLinkErrors, spiLinkTimeouts);
+	enqueue(qu, to_send);
+
+	// frames coming in, the sequence counters stay at zero while the link runs in format 1
+	struct structSpiLinkMetrics* link = &spiLink.metrics;
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "SPI received:\t\t%8lu,\tlost %lu, duplicated %lu, out of order %lu, crc failed %lu\r\n", link->received, link->lost, link->duplicated, link->outOfOrder, link->crcFailed);
+	enqueue(qu, to_send);
+
+	memset(to_send, '\0', 150);
+	snprintf(to_send, 150, "Setpoints sent:\t\t%8lu,\theld back %lu\r\n", spiFilterTransmit.metrics.passed, spiFilterTransmit.metrics.held);
+	enqueue(qu, to_send);
+
+	// the retransmit window only exists with spi_reliable
+	if (spiWindowLink != NULL) {
+		struct structSpiWindowMetrics* window = &spiWindowLink->metrics;
+		memset(to_send, '\0', 150);
+		snprintf(to_send, 150, "SPI acks:\t\t%8lu,\tresent %lu, expired %lu, unacked %u\r\n", window->acked, window->resent, window->expired, spiWindowLink->count);
+		enqueue(qu, to_send);
+	}
+
+	print_cpu(qu);
+}
+
+// cpu share of every task since the last call, taken from the freertos run time stats
+void print_cpu(struct queue* qu) {
+	// run time counters are indexed by task number, the few tasks of this system fit easily
+	static uint32_t run_time_last[16] = {0};
+	static uint32_t total_last = 0;
+	TaskStatus_t tasks[8];
+	configRUN_TIME_COUNTER_TYPE total = 0;
+	UBaseType_t count = uxTaskGetSystemState(tasks, 8, &total);
+	uint32_t total_delta = (uint32_t)total - total_last;
+	total_last = (uint32_t)total;
+	if (total_delta == 0) {
+		return;
+	}
+	char to_send[150] = {'\0'};
+	int length = snprintf(to_send, 150, "CPU (%%):\t");
+	for (UBaseType_t index = 0; index < count; index++) {
+		uint32_t number = tasks[index].xTaskNumber % 16;
+		uint32_t delta = (uint32_t)tasks[index].ulRunTimeCounter - run_time_last[number];
+		run_time_last[number] = (uint32_t)tasks[index].ulRunTimeCounter;
+		if (length < 150) {
+			length += snprintf(to_send + length, 150 - length, "%s %.1f  ", tasks[index].pcTaskName, 100.0 * delta / total_delta);
+		}
+	}
+	if (length < 148) {
+		snprintf(to_send + length, 150 - length, "\r\n");
+	}
+	enqueue(qu, to_send);
 }
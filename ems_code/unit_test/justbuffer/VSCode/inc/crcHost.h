@@ -0,0 +1,30 @@
+/**
+ * @file crcHost.h
+ * @author Sefa Ozturk (S.H.Ozturk@outlook.com)
+ * @brief crc for host side tooling, carry-less multiply folding with a table fallback
+ * @version 0.6
+ * @date 2025-05-06
+ */
+
+#ifndef CRCHOST_H
+#define CRCHOST_H
+
+/** @brief smallest piece handed to the carry-less multiply path, shorter pieces go through the tables */
+#define CRC_HOST_FOLD_MIN 64
+
+/**
+ * @brief crc with the semantics of structcrcconfig for long captures and logs
+ * @note  initialise with crchostinit(), stream with crcbegin(), crchostupdate() and crcfinal()
+ */
+struct structCrcHost {
+	struct structCrcData crcData; /**< config with slicing-by-8 tables, used for short pieces, tails and the fallback */
+	uint64_t fold512[2];		  /**< carry-less multiply constants folding a 128 bit lane over 512 bits */
+	uint64_t fold128[2];		  /**< carry-less multiply constants folding a 128 bit lane over 128 bits */
+	bool clmul;					  /**< carry-less multiply selected at runtime, clear to force the fallback */
+};
+
+int8_t crcHostInit(struct structCrcHost* crcHostArg, const struct structCrcConfig* configArg);
+void crcHostUpdate(const struct structCrcHost* crcHostArg, struct structCrcStream* streamArg, uint8_t arrayArg[], uint32_t arraySizeArg);
+uint32_t crcHostCalc(const struct structCrcHost* crcHostArg, uint8_t arrayArg[], uint32_t arraySizeArg);
+
+#endif
@@ -0,0 +1,520 @@
+/**
+ * @file benchmark.c
+ * @author Sefa Ozturk (S.H.Ozturk@outlook.com)
+ * @brief host benchmarks for the spiqueue
+ * @version 0.6
+ * @date 2025-05-06
+ */
+
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+/** @brief unit counted by benchcycles() */
+#define BENCH_CYCLE_UNIT "cycle"
+#else
+#define BENCH_CYCLE_UNIT "ns"
+#endif
+
+// compiled as one unit with the spiqueue so both paths get the same optimization
+#include "spiQueue.c"
+#include "crcHost.c"
+
+/** @brief amount of frames pushed through a queue per measurement */
+#define BENCH_FRAMES 1000000
+/** @brief amount of bytes checksummed per crc measurement */
+#define BENCH_CRC_BYTES 64000000
+
+// TIMING -------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief monotonic timestamp
+ * @retval time in nanoseconds
+ */
+static uint64_t benchNow(void) {
+	struct timespec timeTemp;
+	clock_gettime(CLOCK_MONOTONIC, &timeTemp);
+	return (uint64_t)timeTemp.tv_sec * 1000000000u + timeTemp.tv_nsec;
+}
+
+/**
+ * @brief prints a single result line
+ * @param[in] nameArg name of the measured path
+ * @param[in] depthArg queue depth used during the measurement
+ * @param[in] nanoSecondsArg total duration of the measurement
+ * @param[in] framesArg amount of frames handled during the measurement
+ */
+static void benchPrint(const char* nameArg, uint16_t depthArg, uint64_t nanoSecondsArg, uint32_t framesArg) {
+	printf("%-24s depth %3u: %7.2f ns/frame\n", nameArg, depthArg, (double)nanoSecondsArg / framesArg);
+}
+
+/**
+ * @brief cycle counter of the host
+ * @retval time stamp counter on x86, nanoseconds on hosts without a readable counter
+ */
+static uint64_t benchCycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return benchNow();
+#endif
+}
+
+// LEGACY -------------------------------------------------------------------------------------------------------------------
+
+/** @brief copy of the spiqueue before the packet pool, every packet is malloced and freed */
+struct structLegacyQueue {
+	uint8_t sizeCurrent;				/**< number of current packets inside the queue */
+	uint8_t sizeMax;					/**< number of maximum allowed packets inside the queue */
+	struct structPacket* tailPacketPtr; /**< pointer to the last appended packet */
+	struct structPacket* headPacketPtr; /**< pointer to the first appended packet */
+};
+
+/**
+ * @brief legacy spiqueuepostarray, mallocs a packet per frame
+ * @param[in] queueArg pointer to the legacy queue
+ * @param[in] arrayArg frame
+ * @retval 0 on success, -1 on failure
+ */
+static int8_t legacyPostArray(struct structLegacyQueue* queueArg, uint8_t arrayArg[]) {
+	if (queueArg->sizeCurrent >= queueArg->sizeMax) {
+		return -1;
+	}
+	struct structPacket* newPacket = malloc(sizeof(struct structPacket));
+	if (newPacket == NULL) {
+		return -1;
+	}
+	newPacket->identifier = arrayArg[SQ_ID_INDEX];
+	memcpy(newPacket->payload.uint8, arrayArg + SQ_PAYLOAD_INDEX, SQ_PAYLOAD_SIZE);
+	memcpy(newPacket->ack.returnCrc.uint8, arrayArg + SQ_ACK_INDEX, SQ_ACK_SIZE);
+	memcpy(newPacket->crc.value.uint8, arrayArg + SQ_CRC_INDEX, SQ_CRC_SIZE);
+	newPacket->crc.verified = false;
+	newPacket->crc.good = false;
+	newPacket->ack.retrieved = false;
+	newPacket->nextPacketPtr = NULL;
+	if (queueArg->headPacketPtr == NULL) {
+		queueArg->headPacketPtr = newPacket;
+	} else {
+		queueArg->tailPacketPtr->nextPacketPtr = newPacket;
+	}
+	queueArg->tailPacketPtr = newPacket;
+	queueArg->sizeCurrent++;
+	return 0;
+}
+
+/**
+ * @brief legacy spiqueuepacketremove, frees the head packet
+ * @param[in] queueArg pointer to the legacy queue
+ * @retval 0 on success, -1 on failure
+ */
+static int8_t legacyPacketRemove(struct structLegacyQueue* queueArg) {
+	struct structPacket* previousHeadPacketPtr = queueArg->headPacketPtr;
+	if (previousHeadPacketPtr == NULL) {
+		return -1;
+	}
+	queueArg->headPacketPtr = previousHeadPacketPtr->nextPacketPtr;
+	if (queueArg->headPacketPtr == NULL) {
+		queueArg->tailPacketPtr = NULL;
+	}
+	queueArg->sizeCurrent--;
+	free(previousHeadPacketPtr);
+	return 0;
+}
+
+// QUEUE --------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief fills the queue up to depthArg frames and drains it again until BENCH_FRAMES went through, legacy path
+ * @param[in] depthArg amount of frames kept in flight
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchLegacy(uint16_t depthArg) {
+	struct structLegacyQueue queue = {0, UINT8_MAX, NULL, NULL};
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += depthArg) {
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			raw[SQ_ID_INDEX] = depth;
+			legacyPostArray(&queue, raw);
+		}
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			memcpy(rawGet + SQ_ID_INDEX, &(queue.headPacketPtr->identifier), SQ_ID_SIZE);
+			memcpy(rawGet + SQ_PAYLOAD_INDEX, queue.headPacketPtr->payload.uint8, SQ_PAYLOAD_SIZE);
+			memcpy(rawGet + SQ_ACK_INDEX, queue.headPacketPtr->ack.returnCrc.uint8, SQ_ACK_SIZE);
+			memcpy(rawGet + SQ_CRC_INDEX, queue.headPacketPtr->crc.value.uint8, SQ_CRC_SIZE);
+			legacyPacketRemove(&queue);
+		}
+	}
+	return benchNow() - start;
+}
+
+/**
+ * @brief fills the queue up to depthArg frames and drains it again until BENCH_FRAMES went through, pool path
+ * @param[in] depthArg amount of frames kept in flight
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchPool(uint16_t depthArg) {
+	struct structSpiQueue* queue = NULL;
+	spiQueueCreate(&queue, UINT8_MAX);
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += depthArg) {
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			raw[SQ_ID_INDEX] = depth;
+			spiQueuePostArray(queue, raw, SQ_PACKET_SIZE, false);
+		}
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			spiQueueGetArray(queue, rawGet, SQ_PACKET_SIZE);
+			spiQueuePacketRemove(queue);
+		}
+	}
+	uint64_t stop = benchNow();
+	spiQueueRemove(&queue);
+	return stop - start;
+}
+
+/**
+ * @brief fills the spiring up to depthArg frames and drains it again with a copy on both ends, like the packet path
+ * @param[in] depthArg amount of frames kept in flight
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchRingCopy(uint16_t depthArg) {
+	struct structSpiRing* ring = NULL;
+	spiRingCreate(&ring, 128);
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	volatile uint8_t sink = 0;
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += depthArg) {
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			raw[SQ_ID_INDEX] = depth;
+			spiRingPostArray(ring, raw, SQ_PACKET_SIZE);
+		}
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			spiRingGetArray(ring, rawGet, SQ_PACKET_SIZE);
+			sink = rawGet[SQ_ID_INDEX];
+		}
+	}
+	uint64_t stop = benchNow();
+	(void)sink;
+	spiRingRemove(&ring);
+	return stop - start;
+}
+
+/**
+ * @brief same as benchringcopy but the frame is written into the reserved slot and read in place, like the dma path
+ * @param[in] depthArg amount of frames kept in flight
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchRingZeroCopy(uint16_t depthArg) {
+	struct structSpiRing* ring = NULL;
+	spiRingCreate(&ring, 128);
+	volatile uint8_t sink = 0;
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += depthArg) {
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			uint8_t* slotFrame = spiRingReserve(ring);
+			slotFrame[SQ_ID_INDEX] = depth;
+			spiRingCommit(slotFrame);
+		}
+		for (uint16_t depth = 0; depth < depthArg; depth++) {
+			sink = spiFrameGetId(spiRingPeek(ring));
+			spiRingRelease(ring);
+		}
+	}
+	uint64_t stop = benchNow();
+	(void)sink;
+	spiRingRemove(&ring);
+	return stop - start;
+}
+
+// BATCH --------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief posts and drains batchArg setpoints per round with single calls until BENCH_FRAMES went through
+ * @param[in] batchArg amount of frames per round
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchSingle(uint8_t batchArg) {
+	struct structSpiQueue* queue = NULL;
+	spiQueueCreate(&queue, UINT8_MAX);
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += batchArg) {
+		for (uint8_t index = 0; index < batchArg; index++) {
+			spiQueuePostFrac(queue, ID_TEST_FRAC64, (double)frame + index);
+		}
+		for (uint8_t index = 0; index < batchArg; index++) {
+			spiQueueGetArray(queue, rawGet, SQ_PACKET_SIZE);
+			spiQueuePacketRemove(queue);
+		}
+	}
+	uint64_t stop = benchNow();
+	spiQueueRemove(&queue);
+	return stop - start;
+}
+
+/**
+ * @brief same as benchsingle but with spiqueuepostmany() and spiqueuegetburst()
+ * @param[in] batchArg amount of frames per round
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchBatch(uint8_t batchArg) {
+	struct structSpiQueue* queue = NULL;
+	spiQueueCreate(&queue, UINT8_MAX);
+	uint8_t ids[UINT8_MAX];
+	double values[UINT8_MAX];
+	uint8_t burst[UINT8_MAX * SQ_PACKET_SIZE];
+	memset(ids, ID_TEST_FRAC64, sizeof(ids));
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += batchArg) {
+		for (uint8_t index = 0; index < batchArg; index++) {
+			values[index] = (double)frame + index;
+		}
+		spiQueuePostMany(queue, ids, values, batchArg);
+		spiQueueGetBurst(queue, burst, batchArg);
+	}
+	uint64_t stop = benchNow();
+	spiQueueRemove(&queue);
+	return stop - start;
+}
+
+// LINK ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief cpu side of the spi task per transaction, frames are queued, moved into the dma buffer, removed and decoded
+ * @param[in] burstArg frames per transaction, 1 runs the single frame path with spiqueuegetarray() and spiqueueprocessack()
+ * @retval duration in nanoseconds
+ * @note - the dma transfer itself is left out, a loopback copy stands in for the received frames
+ */
+static uint64_t benchLink(uint8_t burstArg) {
+	struct structSpiQueue* queue = NULL;
+	spiQueueCreate(&queue, UINT8_MAX);
+	uint8_t dmaTransmit[UINT8_MAX * SQ_PACKET_SIZE];
+	uint8_t dmaReceive[UINT8_MAX * SQ_PACKET_SIZE];
+	volatile double sink = 0;
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += burstArg) {
+		for (uint8_t index = 0; index < burstArg; index++) {
+			spiQueuePostFrac(queue, ID_TEST_FRAC64, (double)frame + index);
+		}
+		int16_t frames = 1;
+		if (burstArg == 1) {
+			spiQueueGetArray(queue, dmaTransmit, SQ_PACKET_SIZE);
+			spiQueuePacketRemove(queue);
+		} else {
+			frames = spiQueueGetBurst(queue, dmaTransmit, burstArg);
+		}
+		memcpy(dmaReceive, dmaTransmit, frames * SQ_PACKET_SIZE);
+		for (int16_t index = 0; index < frames; index++) {
+			uint8_t* receiveFrame = dmaReceive + index * SQ_PACKET_SIZE;
+			if (spiFrameCrcGood(receiveFrame)) {
+				sink = spiFrameGetPayload(receiveFrame).frac64;
+			}
+		}
+	}
+	uint64_t stop = benchNow();
+	(void)sink;
+	spiQueueRemove(&queue);
+	return stop - start;
+}
+
+// RECEIVE ------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief fills a frame as the dma would, with a frac64 payload and a good crc
+ * @param[out] frameArg frame in wire layout
+ * @param[in] valueArg payload value
+ */
+static void benchReceiveFill(uint8_t frameArg[], double valueArg) {
+	union unionPayload payload = {0};
+	union unionCrc crc;
+	payload.frac64 = valueArg;
+	frameArg[SQ_ID_INDEX] = ID_TEST_FRAC64;
+	memcpy(frameArg + SQ_PAYLOAD_INDEX, payload.uint8, SQ_PAYLOAD_SIZE);
+	crc.uint16 = GETCRC(frameArg);
+	memcpy(frameArg + SQ_CRC_INDEX, crc.uint8, SQ_CRC_SIZE);
+}
+
+/**
+ * @brief received frame is posted to a spiqueue with crc check, decoded from the packet and removed
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchReceiveQueue(void) {
+	struct structSpiQueue* queue = NULL;
+	spiQueueCreate(&queue, 1);
+	uint8_t dmaBuffer[SQ_PACKET_SIZE] = {0};
+	volatile double sink = 0;
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+		benchReceiveFill(dmaBuffer, frame);
+		spiQueuePostArray(queue, dmaBuffer, SQ_PACKET_SIZE, true);
+		if (queue->headPacketPtr->crc.good) {
+			sink = queue->headPacketPtr->payload.frac64;
+		}
+		spiQueuePacketRemove(queue);
+	}
+	uint64_t stop = benchNow();
+	(void)sink;
+	spiQueueRemove(&queue);
+	return stop - start;
+}
+
+/**
+ * @brief frame is received into a spiring slot, checked and decoded in place and released
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchReceiveRing(void) {
+	struct structSpiRing* ring = NULL;
+	spiRingCreate(&ring, 128);
+	volatile double sink = 0;
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+		uint8_t* slotFrame = spiRingReserve(ring);
+		benchReceiveFill(slotFrame, frame);
+		spiRingCommit(slotFrame);
+		uint8_t* peekFrame = spiRingPeek(ring);
+		if (spiFrameCrcGood(peekFrame)) {
+			sink = spiFrameGetPayload(peekFrame).frac64;
+		}
+		spiRingRelease(ring);
+	}
+	uint64_t stop = benchNow();
+	(void)sink;
+	spiRingRemove(&ring);
+	return stop - start;
+}
+
+/**
+ * @brief frame is checked and decoded straight from the dma buffer
+ * @retval duration in nanoseconds
+ */
+static uint64_t benchReceiveDirect(void) {
+	uint8_t dmaBuffer[SQ_SLOT_SIZE] = {0};
+	volatile double sink = 0;
+	uint64_t start = benchNow();
+	for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+		benchReceiveFill(dmaBuffer, frame);
+		if (spiFrameCrcGood(dmaBuffer)) {
+			sink = spiFrameGetPayload(dmaBuffer).frac64;
+		}
+	}
+	uint64_t stop = benchNow();
+	(void)sink;
+	return stop - start;
+}
+
+// CRC ----------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief checksums bench_crc_bytes in chunks of the given size, an eighth of it for the slow method
+ * @param[in] nameArg name of the measured kernel
+ * @param[in] crcDataArg initialised crcdata, config.slicing selects the kernel of crccalcfast()
+ * @param[in] slowArg use crccalcslow() instead of crccalcfast()
+ * @param[in] crcHostArg use crchostcalc() on this host crc instead of crccalcfast(), null otherwise
+ * @param[in] chunkSizeArg bytes per crc call, a frame or a larger buffer
+ */
+static void benchCrc(const char* nameArg, struct structCrcData* crcDataArg, bool slowArg, const struct structCrcHost* crcHostArg, uint32_t chunkSizeArg) {
+	uint8_t* buffer = malloc(chunkSizeArg);
+	for (uint32_t byte = 0; byte < chunkSizeArg; byte++) {
+		buffer[byte] = rand();
+	}
+	uint32_t calls = BENCH_CRC_BYTES / chunkSizeArg / (slowArg ? 8 : 1);
+	volatile uint32_t sink = 0;
+	uint64_t startNs = benchNow();
+	uint64_t startCycles = benchCycles();
+	for (uint32_t call = 0; call < calls; call++) {
+		buffer[0] = call;
+		if (crcHostArg != NULL) {
+			sink = crcHostCalc(crcHostArg, buffer, chunkSizeArg);
+		} else {
+			sink = slowArg ? crcCalcSlow(crcDataArg, buffer, chunkSizeArg) : crcCalcFast(crcDataArg, buffer, chunkSizeArg);
+		}
+	}
+	uint64_t cycles = benchCycles() - startCycles;
+	uint64_t nanoSeconds = benchNow() - startNs;
+	(void)sink;
+	free(buffer);
+	double bytes = (double)calls * chunkSizeArg;
+	printf("%-24s %6u B: %6.3f bytes/" BENCH_CYCLE_UNIT " %8.1f MB/s\n", nameArg, chunkSizeArg, bytes / cycles, bytes * 1000 / nanoSeconds);
+}
+
+// MAIN ---------------------------------------------------------------------------------------------------------------------
+
+/** Main function running all benchmarks */
+int main(void) {
+	const uint16_t depths[] = {1, 4, 16, 100};
+	crcData.config.bitLength = 16;
+	crcData.config.polynomial = X(12) + X(5) + X(0);
+	crcInit(&crcData);
+
+	printf("\nspiqueue post/get/remove, %u frames\n", BENCH_FRAMES);
+	for (uint8_t index = 0; index < arraysize(depths); index++) {
+		benchPrint("malloc linked list", depths[index], benchLegacy(depths[index]), BENCH_FRAMES);
+		benchPrint("packet pool", depths[index], benchPool(depths[index]), BENCH_FRAMES);
+	}
+	printf("\nspiring post/get, %u frames\n", BENCH_FRAMES);
+	for (uint8_t index = 0; index < arraysize(depths); index++) {
+		benchPrint("ring copy", depths[index], benchRingCopy(depths[index]), BENCH_FRAMES);
+		benchPrint("ring zero copy", depths[index], benchRingZeroCopy(depths[index]), BENCH_FRAMES);
+	}
+	const uint8_t batches[] = {1, 4, 16, 64};
+	printf("\nspiqueue setpoint post/get, %u frames\n", BENCH_FRAMES);
+	for (uint8_t index = 0; index < arraysize(batches); index++) {
+		benchPrint("single post/get", batches[index], benchSingle(batches[index]), BENCH_FRAMES);
+		benchPrint("postmany/getburst", batches[index], benchBatch(batches[index]), BENCH_FRAMES);
+	}
+	// the spi task starts one transaction per scheduler tick, so the link rate scales with the frames per transaction
+	const uint8_t bursts[] = {1, 4, 8, 16};
+	printf("\nspi task transaction, %u frames, one transaction per 1 ms tick\n", BENCH_FRAMES);
+	for (uint8_t index = 0; index < arraysize(bursts); index++) {
+		uint64_t nanoSeconds = benchLink(bursts[index]);
+		printf("%-24s burst %3u: %7.2f ns/frame, %7.2f ns/transaction, link %6u frames/s\n", bursts[index] == 1 ? "single frame" : "burst",
+			   bursts[index], (double)nanoSeconds / BENCH_FRAMES, (double)nanoSeconds * bursts[index] / BENCH_FRAMES, bursts[index] * 1000u);
+	}
+	printf("\nreceive check/decode, %u frames\n", BENCH_FRAMES);
+	benchPrint("spiqueue packet", 1, benchReceiveQueue(), BENCH_FRAMES);
+	benchPrint("spiring slot", 1, benchReceiveRing(), BENCH_FRAMES);
+	benchPrint("dma buffer", 1, benchReceiveDirect(), BENCH_FRAMES);
+
+	// crc-16/xmodem as used on the link, and crc-16/kermit for the reflected path
+	struct structCrcData crcNormal[3] = {0};
+	struct structCrcData crcReflected[3] = {0};
+	const uint8_t slicings[] = {1, 4, 8};
+	for (uint8_t index = 0; index < arraysize(slicings); index++) {
+		crcNormal[index].config = crcData.config;
+		crcNormal[index].config.slicing = slicings[index];
+		crcInit(&crcNormal[index]);
+		crcReflected[index].config = crcData.config;
+		crcReflected[index].config.inputReflected = true;
+		crcReflected[index].config.resultReflected = true;
+		crcReflected[index].config.slicing = slicings[index];
+		crcInit(&crcReflected[index]);
+	}
+	const uint32_t chunks[] = {SQ_FRAME_SIZE, SQ_PACKET_SIZE, 4096, 65536};
+	printf("\ncrc-16, %u bytes\n", BENCH_CRC_BYTES);
+	for (uint8_t index = 0; index < arraysize(chunks); index++) {
+		benchCrc("slow", &crcNormal[0], true, NULL, chunks[index]);
+		benchCrc("fast", &crcNormal[0], false, NULL, chunks[index]);
+		benchCrc("slicing-by-4", &crcNormal[1], false, NULL, chunks[index]);
+		benchCrc("slicing-by-8", &crcNormal[2], false, NULL, chunks[index]);
+		benchCrc("fast reflected", &crcReflected[0], false, NULL, chunks[index]);
+		benchCrc("slicing-by-8 reflected", &crcReflected[2], false, NULL, chunks[index]);
+	}
+	struct structCrcHost crcHostNormal;
+	struct structCrcHost crcHostReflected;
+	crcHostInit(&crcHostNormal, &crcNormal[0].config);
+	crcHostInit(&crcHostReflected, &crcReflected[0].config);
+	struct structCrcHost crcHostFallback = crcHostNormal;
+	crcHostFallback.clmul = false;
+	const uint32_t captures[] = {4096, 65536, 1048576};
+	printf("\ncrc-16 host tooling, %u bytes, carry-less multiply %s\n", BENCH_CRC_BYTES, crcHostNormal.clmul ? "available" : "unavailable");
+	for (uint8_t index = 0; index < arraysize(captures); index++) {
+		benchCrc("host", NULL, false, &crcHostNormal, captures[index]);
+		benchCrc("host reflected", NULL, false, &crcHostReflected, captures[index]);
+		benchCrc("host table fallback", NULL, false, &crcHostFallback, captures[index]);
+	}
+	return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file crcHost.c
+ * @author Sefa Ozturk (S.H.Ozturk@outlook.com)
+ * @brief crc for host side tooling, carry-less multiply folding with a table fallback
+ * @version 0.6
+ * @date 2025-05-06
+ */
+
+#include "spiQueue.h"
+#include "crcHost.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+/** @brief pclmulqdq folding is compiled in, whether it runs is decided by crchostinit() */
+#define CRC_HOST_X86 1
+#else
+#define CRC_HOST_X86 0
+#endif
+
+/**
+ * @brief remainder of x^exponent divided by the 32 bit generator
+ * @param[in] polynomialArg generator without the x^32 term
+ * @param[in] exponentArg exponent of x
+ * @retval remainder
+ */
+static uint32_t crcHostPowerMod(uint32_t polynomialArg, uint16_t exponentArg) {
+	uint32_t remainder = 1;
+	for (uint16_t bit = 0; bit < exponentArg; bit++) {
+		remainder = (remainder & 0x80000000) ? (remainder << 1) ^ polynomialArg : remainder << 1;
+	}
+	return remainder;
+}
+
+/**
+ * @brief folding constant for the reflected lane layout
+ * @param[in] polynomialArg generator without the x^32 term
+ * @param[in] exponentArg exponent of x the constant stands for
+ * @retval reflected x^(exponent - 32) mod generator, shifted left by one
+ * @note - a reflected carry-less product lands 32 bits lower than the lane layout, the 32 is taken off the exponent instead
+ */
+static uint64_t crcHostReflectedConstant(uint32_t polynomialArg, uint16_t exponentArg) {
+	uint32_t remainder = crcHostPowerMod(polynomialArg, exponentArg - 32);
+	uint32_t reflection = 0;
+	for (uint8_t bit = 0; bit < 32; bit++) {
+		if (remainder & ((uint32_t)1 << bit)) {
+			reflection |= (uint32_t)1 << (31 - bit);
+		}
+	}
+	return (uint64_t)reflection << 1;
+}
+
+/**
+ * @brief initialize a host crc using the fields of a crc config
+ * @param[out] crcHostArg host crc to initialise
+ * @param[in] configArg crc config, the slicing field is ignored
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher() through crcinit()
+ * @note - crc of any width runs as a 32 bit crc with the polynomial shifted to the top, reflected or not
+ */
+int8_t crcHostInit(struct structCrcHost* crcHostArg, const struct structCrcConfig* configArg) {
+	memset(crcHostArg, 0, sizeof(*crcHostArg));
+	crcHostArg->crcData.config = *configArg;
+	crcHostArg->crcData.config.slicing = 8;
+	if (crcInit(&crcHostArg->crcData) != 0) {
+		return -1;
+	}
+	uint32_t polynomial = configArg->polynomial << (32 - configArg->bitLength);
+	// low constant multiplies the low lane half, high constant the high lane half
+	if (configArg->inputReflected) {
+		crcHostArg->fold512[0] = crcHostReflectedConstant(polynomial, 512 + 64);
+		crcHostArg->fold512[1] = crcHostReflectedConstant(polynomial, 512);
+		crcHostArg->fold128[0] = crcHostReflectedConstant(polynomial, 128 + 64);
+		crcHostArg->fold128[1] = crcHostReflectedConstant(polynomial, 128);
+	} else {
+		crcHostArg->fold512[0] = crcHostPowerMod(polynomial, 512);
+		crcHostArg->fold512[1] = crcHostPowerMod(polynomial, 512 + 64);
+		crcHostArg->fold128[0] = crcHostPowerMod(polynomial, 128);
+		crcHostArg->fold128[1] = crcHostPowerMod(polynomial, 128 + 64);
+	}
+#if CRC_HOST_X86
+	__builtin_cpu_init();
+	crcHostArg->clmul = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+#endif
+	return 0;
+}
+
+#if CRC_HOST_X86
+/**
+ * @brief folds whole 64 byte blocks into one 16 byte lane using pclmulqdq
+ * @param[in] crcHostArg host crc initialised by crchostinit()
+ * @param[out] foldedArg 16 bytes in message order with the same crc as the folded blocks
+ * @param[in] checksumArg running checksum, xored into the first word like the sliced kernel does
+ * @param[in] arrayArg array pointer to data, at least crc_host_fold_min bytes
+ * @param[in] arraySizeArg size of arrayarg
+ * @retval number of bytes folded, a multiple of 64
+ * @note - four lanes run in parallel over 512 bit strides and are folded together over 128 bits at the end
+ */
+__attribute__((target("pclmul,ssse3"))) static uint32_t crcHostFold(const struct structCrcHost* crcHostArg, uint8_t foldedArg[], uint32_t checksumArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
+	bool reflected = crcHostArg->crcData.config.inputReflected;
+	// lanes hold the highest power in the top bit, so the bytes of a normal crc are swapped on load and store
+	const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i fold512 = _mm_set_epi64x((int64_t)crcHostArg->fold512[1], (int64_t)crcHostArg->fold512[0]);
+	const __m128i fold128 = _mm_set_epi64x((int64_t)crcHostArg->fold128[1], (int64_t)crcHostArg->fold128[0]);
+	__m128i lane[4];
+	for (uint8_t index = 0; index < 4; index++) {
+		lane[index] = _mm_loadu_si128((const __m128i*)(arrayArg + 16 * index));
+		if (!reflected) {
+			lane[index] = _mm_shuffle_epi8(lane[index], swap);
+		}
+	}
+	lane[0] = _mm_xor_si128(lane[0], reflected ? _mm_cvtsi32_si128((int32_t)checksumArg) : _mm_set_epi32((int32_t)checksumArg, 0, 0, 0));
+	uint32_t done = 64;
+	for (; done + 64 <= arraySizeArg; done += 64) {
+		for (uint8_t index = 0; index < 4; index++) {
+			__m128i next = _mm_loadu_si128((const __m128i*)(arrayArg + done + 16 * index));
+			if (!reflected) {
+				next = _mm_shuffle_epi8(next, swap);
+			}
+			__m128i low = _mm_clmulepi64_si128(lane[index], fold512, 0x00);
+			__m128i high = _mm_clmulepi64_si128(lane[index], fold512, 0x11);
+			lane[index] = _mm_xor_si128(_mm_xor_si128(low, high), next);
+		}
+	}
+	__m128i folded = lane[0];
+	for (uint8_t index = 1; index < 4; index++) {
+		__m128i low = _mm_clmulepi64_si128(folded, fold128, 0x00);
+		__m128i high = _mm_clmulepi64_si128(folded, fold128, 0x11);
+		folded = _mm_xor_si128(_mm_xor_si128(low, high), lane[index]);
+	}
+	if (!reflected) {
+		folded = _mm_shuffle_epi8(folded, swap);
+	}
+	_mm_storeu_si128((__m128i*)foldedArg, folded);
+	return done;
+}
+#endif
+
+/**
+ * @brief feed the next piece of data into a host crc stream
+ * @param[in] crcHostArg host crc initialised by crchostinit()
+ * @param[in] streamArg stream started by crcbegin() on crchostarg->crcdata
+ * @param[in] arrayArg array pointer to the next piece
+ * @param[in] arraySizeArg size of arrayarg, pieces may have any size
+ */
+void crcHostUpdate(const struct structCrcHost* crcHostArg, struct structCrcStream* streamArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
+	uint32_t done = 0;
+#if CRC_HOST_X86
+	if (crcHostArg->clmul && arraySizeArg >= CRC_HOST_FOLD_MIN) {
+		uint8_t folded[16];
+		done = crcHostFold(crcHostArg, folded, streamArg->checksum, arrayArg, arraySizeArg);
+		// the folded lane already carries the running checksum, continue from zero
+		streamArg->checksum = 0;
+		crcUpdate(streamArg, folded, sizeof(folded));
+	}
+#else
+	(void)crcHostArg;
+#endif
+	crcUpdate(streamArg, arrayArg + done, arraySizeArg - done);
+}
+
+/**
+ * @brief calculate crc over a whole buffer
+ * @param[in] crcHostArg host crc initialised by crchostinit()
+ * @param[in] arrayArg array pointer to data
+ * @param[in] arraySizeArg size of arrayarg
+ * @retval checksum masked depending on crc bitlength
+ */
+uint32_t crcHostCalc(const struct structCrcHost* crcHostArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
+	struct structCrcStream stream;
+	crcBegin(&stream, &crcHostArg->crcData);
+	crcHostUpdate(crcHostArg, &stream, arrayArg, arraySizeArg);
+	return crcFinal(&stream);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file crcTableGen.c
+ * @author Sefa Ozturk (S.H.Ozturk@outlook.com)
+ * @brief generates crctables.h, the const crc tables of the named crc configurations
+ * @version 0.6
+ * @date 2025-05-06
+ */
+
+#include <stdio.h>
+
+// compiled as one unit with the spiqueue so the tables come from the same crcinit()
+#include "spiQueue.c"
+
+/** @brief named crc configuration written to crctables.h */
+struct structCrcTableGenNamed {
+	const char* name;			   /**< name of the const structcrcdata */
+	const char* brief;			   /**< doc comment of the const structcrcdata */
+	struct structCrcConfig config; /**< config handed to crcinit() */
+};
+
+// clang-format off
+/** @brief named crc configurations, every entry needs an extern declaration in spiqueue.h */
+static const struct structCrcTableGenNamed named[] = {
+	{"crcXmodem16",		"crc-16/xmodem, the crc of the spi link and of mx_crc_init()",	{16, 0x1021,		0x0000,		0x0000,		false,	false,	8}},
+	{"crcIsoHdlc32",	"crc-32/iso-hdlc, reflected, for host side logs and captures",	{32, 0x04C11DB7,	0xFFFFFFFF,	0xFFFFFFFF,	true,	true,	8}},
+};
+// clang-format on
+
+/**
+ * @brief writes the values of one table as rows of an initializer
+ * @param[in] fileArg output file
+ * @param[in] tableArg table values
+ * @param[in] digitsArg hex digits per value
+ * @param[in] indentArg tabs in front of every row
+ */
+static void crcTableGenValues(FILE* fileArg, const uint32_t tableArg[], uint8_t digitsArg, uint8_t indentArg) {
+	uint8_t columns = (digitsArg == 8 ? 8 : 16);
+	for (uint16_t index = 0; index < 256; index++) {
+		if (index % columns == 0) {
+			fprintf(fileArg, "%.*s", indentArg, "\t\t\t\t");
+		}
+		fprintf(fileArg, "0x%0*X,", digitsArg, tableArg[index]);
+		fprintf(fileArg, (index % columns == columns - 1) ? "\n" : " ");
+	}
+}
+
+/**
+ * @brief writes one named configuration as a const structcrcdata
+ * @param[in] fileArg output file
+ * @param[in] namedArg named configuration
+ * @retval 0 on success, -1 on failure
+ */
+static int8_t crcTableGenNamed(FILE* fileArg, const struct structCrcTableGenNamed* namedArg) {
+	struct structCrcData crcDataTemp = {0};
+	crcDataTemp.config = namedArg->config;
+	if (crcInit(&crcDataTemp) != 0) {
+		return -1;
+	}
+	const struct structCrcConfig* config = &crcDataTemp.config;
+	const struct structCrcDataAutomatic* automatic = &crcDataTemp.automatic;
+	uint8_t digits = config->bitLength / 4;
+	fprintf(fileArg, "/** @brief %s */\n", namedArg->brief);
+	fprintf(fileArg, "const struct structCrcData %s = {\n", namedArg->name);
+	fprintf(fileArg, "\t.config = {%u, 0x%0*X, 0x%0*X, 0x%0*X, %s, %s, %u},\n", config->bitLength, digits, config->polynomial, digits,
+			config->initialValue, digits, config->finalXorValue, config->inputReflected ? "true" : "false",
+			config->resultReflected ? "true" : "false", config->slicing);
+	fprintf(fileArg, "\t.automatic = {\n");
+	fprintf(fileArg, "\t\t.bitLengthMask = 0x%08X,\n", automatic->bitLengthMask);
+	fprintf(fileArg, "\t\t.lookUpTable = {\n");
+	crcTableGenValues(fileArg, automatic->lookUpTable, digits, 3);
+	fprintf(fileArg, "\t\t},\n");
+	fprintf(fileArg, "\t\t.reflectTable = {\n");
+	uint32_t reflectTemp[256];
+	for (uint16_t index = 0; index < 256; index++) {
+		reflectTemp[index] = automatic->reflectTable[index];
+	}
+	crcTableGenValues(fileArg, reflectTemp, 2, 3);
+	fprintf(fileArg, "\t\t},\n");
+	fprintf(fileArg, "\t\t.sliceTable = {\n");
+	for (uint8_t slice = 0; slice < config->slicing; slice++) {
+		fprintf(fileArg, "\t\t\t{\n");
+		crcTableGenValues(fileArg, automatic->sliceTable[slice], 8, 4);
+		fprintf(fileArg, "\t\t\t},\n");
+	}
+	fprintf(fileArg, "\t\t},\n");
+	fprintf(fileArg, "\t},\n};\n\n");
+	return 0;
+}
+
+/**
+ * @brief writes crctables.h
+ * @param[in] argc 2
+ * @param[in] argv output path of crctables.h
+ * @retval 0 on success, 1 on failure
+ */
+int main(int argc, char* argv[]) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: crcTableGen <path to crcTables.h>\n");
+		return 1;
+	}
+	FILE* file = fopen(argv[1], "w");
+	if (file == NULL) {
+		fprintf(stderr, "crcTableGen: cannot open %s\n", argv[1]);
+		return 1;
+	}
+	fprintf(file, "/**\n");
+	fprintf(file, " * @file crcTables.h\n");
+	fprintf(file, " * @brief const crc tables of the named crc configurations, generated by crctablegen.c, do not edit\n");
+	fprintf(file, " * @note - included by spiqueue.c only, regenerate with the crctables target of the justbuffer project\n");
+	fprintf(file, " * @note - copy the regenerated file to stm_code/ems_rtos/core/inc as well, firmware and host share the tables\n");
+	fprintf(file, " */\n\n");
+	fprintf(file, "#ifndef CRCTABLES_H\n#define CRCTABLES_H\n\n// clang-format off\n");
+	for (uint8_t index = 0; index < arraysize(named); index++) {
+		if (crcTableGenNamed(file, &named[index]) != 0) {
+			fclose(file);
+			return 1;
+		}
+	}
+	fprintf(file, "// clang-format on\n\n#endif\n");
+	fclose(file);
+	return 0;
+}
@@ -1,9 +1,15 @@
 #include "gtest/gtest.h"
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdint.h>
+#include <string>
+#include <time.h>
 
 extern "C" {
 #include "spiQueue.h"
 #include "spiQueueEvil.h"
+#include "crcHost.h"
 }
 
 extern uint8_t errorVal;
@@ -288,6 +294,205 @@ TEST_F(crcTest, crcCalcFast_32bit_mad_loop) {
 	}
 }
 
+TEST_F(crcTest, crcInit_slicing_bad) {
+	RecordProperty("description_1", "crc init fails on a slicing width other than 0, 1, 4 or 8");
+	crcData.config.bitLength = 16;
+	crcData.config.polynomial = X(12) + X(5) + X(0);
+	crcData.config.slicing = 3;
+	ASSERT_EQ(crcInit(&crcData), -1);
+	ASSERT_EQ(errorVal, ec_crc_slicing_bad);
+}
+
+TEST_F(crcTest, crcCalcFast_8bit_sliced_mad_loop) {
+	RecordProperty("description_1", "crcCalcFast slicing-by-4/8 vs crcCalcSlow looped over random lengths");
+	uint8_t raw[64] = {0};
+	crcData.config.bitLength = 8;
+	for (uint8_t loop = 0; loop < 100; loop++) {
+		uint8_t length = rand() % (arraysize(raw) + 1);
+		for (uint8_t arrayIndex = 0; arrayIndex < length; arrayIndex++) {
+			raw[arrayIndex] = rand() % (UINT8_MAX + 1);
+		}
+		crcData.config.polynomial = rand() % UINT8_MAX + 1;
+		crcData.config.initialValue = rand() % (UINT8_MAX + 1);
+		crcData.config.finalXorValue = rand() % (UINT8_MAX + 1);
+		crcData.config.inputReflected = rand() % (true + 1);
+		crcData.config.resultReflected = rand() % (true + 1);
+		crcData.config.slicing = (loop % 2 == 0) ? 4 : 8;
+		ASSERT_EQ(crcInit(&crcData), 0);
+		ASSERT_EQ(crcCalcSlow(&crcData, raw, length), crcCalcFast(&crcData, raw, length));
+		ASSERT_EQ(errorVal, ec_no_error);
+	}
+}
+
+TEST_F(crcTest, crcCalcFast_16bit_sliced_mad_loop) {
+	RecordProperty("description_1", "crcCalcFast slicing-by-4/8 vs crcCalcSlow looped over random lengths");
+	uint8_t raw[64] = {0};
+	crcData.config.bitLength = 16;
+	for (uint8_t loop = 0; loop < 100; loop++) {
+		uint8_t length = rand() % (arraysize(raw) + 1);
+		for (uint8_t arrayIndex = 0; arrayIndex < length; arrayIndex++) {
+			raw[arrayIndex] = rand() % (UINT8_MAX + 1);
+		}
+		crcData.config.polynomial = rand() % UINT16_MAX + 1;
+		crcData.config.initialValue = rand() % (UINT16_MAX + 1);
+		crcData.config.finalXorValue = rand() % (UINT16_MAX + 1);
+		crcData.config.inputReflected = rand() % (true + 1);
+		crcData.config.resultReflected = rand() % (true + 1);
+		crcData.config.slicing = (loop % 2 == 0) ? 4 : 8;
+		ASSERT_EQ(crcInit(&crcData), 0);
+		ASSERT_EQ(crcCalcSlow(&crcData, raw, length), crcCalcFast(&crcData, raw, length));
+		ASSERT_EQ(errorVal, ec_no_error);
+	}
+}
+
+TEST_F(crcTest, crcCalcFast_32bit_sliced_mad_loop) {
+	RecordProperty("description_1", "crcCalcFast slicing-by-4/8 vs crcCalcSlow looped over random lengths");
+	uint8_t raw[64] = {0};
+	crcData.config.bitLength = 32;
+	for (uint8_t loop = 0; loop < 100; loop++) {
+		uint8_t length = rand() % (arraysize(raw) + 1);
+		for (uint8_t arrayIndex = 0; arrayIndex < length; arrayIndex++) {
+			raw[arrayIndex] = rand() % (UINT8_MAX + 1);
+		}
+		crcData.config.polynomial = rand() % UINT32_MAX + 1;
+		crcData.config.initialValue = rand() % ((uint64_t)UINT32_MAX + 1);
+		crcData.config.finalXorValue = rand() % ((uint64_t)UINT32_MAX + 1);
+		crcData.config.inputReflected = rand() % (true + 1);
+		crcData.config.resultReflected = rand() % (true + 1);
+		crcData.config.slicing = (loop % 2 == 0) ? 4 : 8;
+		ASSERT_EQ(crcInit(&crcData), 0);
+		ASSERT_EQ(crcCalcSlow(&crcData, raw, length), crcCalcFast(&crcData, raw, length));
+		ASSERT_EQ(errorVal, ec_no_error);
+	}
+}
+
+TEST_F(crcTest, crcTables_xmodem16) {
+	RecordProperty("description_1", "const crc-16/xmodem tables are bit identical to the tables of crcInit");
+	uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+	crcData.config = crcXmodem16.config;
+	ASSERT_EQ(crcInit(&crcData), 0);
+	ASSERT_EQ(memcmp(&crcData.automatic, &crcXmodem16.automatic, sizeof(crcData.automatic)), 0);
+	ASSERT_EQ(crcCalcFast(&crcXmodem16, check, sizeof(check)), 0x31C3);
+	ASSERT_EQ(crcCalcSlow(&crcXmodem16, check, sizeof(check)), 0x31C3);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(crcTest, crcTables_isohdlc32) {
+	RecordProperty("description_1", "const crc-32/iso-hdlc tables are bit identical to the tables of crcInit");
+	uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+	crcData.config = crcIsoHdlc32.config;
+	ASSERT_EQ(crcInit(&crcData), 0);
+	ASSERT_EQ(memcmp(&crcData.automatic, &crcIsoHdlc32.automatic, sizeof(crcData.automatic)), 0);
+	ASSERT_EQ(crcCalcFast(&crcIsoHdlc32, check, sizeof(check)), 0xCBF43926);
+	ASSERT_EQ(crcCalcSlow(&crcIsoHdlc32, check, sizeof(check)), 0xCBF43926);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(crcTest, crcStream_mad_loop) {
+	RecordProperty("description_1", "crcBegin/crcUpdate/crcFinal over random pieces vs crcCalcSlow over the whole buffer");
+	uint8_t raw[200] = {0};
+	const uint8_t bitLengths[] = {8, 16, 32};
+	const uint8_t slicings[] = {0, 4, 8};
+	for (uint16_t loop = 0; loop < 300; loop++) {
+		for (uint8_t arrayIndex = 0; arrayIndex < arraysize(raw); arrayIndex++) {
+			raw[arrayIndex] = rand() % (UINT8_MAX + 1);
+		}
+		crcData.config.bitLength = bitLengths[loop % 3];
+		uint32_t mask = 0xFFFFFFFF >> (32 - crcData.config.bitLength);
+		crcData.config.polynomial = (rand() & mask) | 1;
+		crcData.config.initialValue = rand() & mask;
+		crcData.config.finalXorValue = rand() & mask;
+		crcData.config.inputReflected = rand() % (true + 1);
+		crcData.config.resultReflected = rand() % (true + 1);
+		crcData.config.slicing = slicings[(loop / 3) % 3];
+		ASSERT_EQ(crcInit(&crcData), 0);
+		struct structCrcStream stream;
+		crcBegin(&stream, &crcData);
+		uint16_t done = 0;
+		while (done < arraysize(raw)) {
+			uint16_t piece = rand() % 20;
+			if (piece > arraysize(raw) - done) {
+				piece = arraysize(raw) - done;
+			}
+			crcUpdate(&stream, raw + done, piece);
+			done += piece;
+		}
+		ASSERT_EQ(crcFinal(&stream), crcCalcSlow(&crcData, raw, arraysize(raw)));
+	}
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(crcTest, crcStream_burst) {
+	RecordProperty("description_1", "one CRCBEGIN/CRCUPDATE/CRCFINAL checksum over a burst of frames equals GETCRC over the burst");
+	uint8_t burst[4 * SQ_PACKET_SIZE] = {0};
+	for (uint8_t arrayIndex = 0; arrayIndex < arraysize(burst); arrayIndex++) {
+		burst[arrayIndex] = rand() % (UINT8_MAX + 1);
+	}
+	struct structCrcStream stream;
+	CRCBEGIN(&stream);
+	for (uint8_t frame = 0; frame < 4; frame++) {
+		CRCUPDATE(&stream, burst + frame * SQ_PACKET_SIZE, SQ_PACKET_SIZE);
+	}
+	ASSERT_EQ(CRCFINAL(&stream), crcCalcSlow(&crcXmodem16, burst, arraysize(burst)));
+	CRCBEGIN(&stream);
+	CRCUPDATE(&stream, burst, SQ_FRAME_SIZE);
+	ASSERT_EQ(CRCFINAL(&stream), GETCRC(burst));
+}
+
+TEST_F(crcTest, crcHostCalc_mad_loop) {
+	RecordProperty("description_1", "crcHostCalc with carry-less multiply and with the table fallback vs crcCalcSlow looped");
+	static uint8_t raw[1000] = {0};
+	const uint8_t bitLengths[] = {8, 16, 32};
+	struct structCrcHost crcHost;
+	for (uint16_t loop = 0; loop < 300; loop++) {
+		uint16_t length = rand() % (arraysize(raw) + 1);
+		for (uint16_t arrayIndex = 0; arrayIndex < length; arrayIndex++) {
+			raw[arrayIndex] = rand() % (UINT8_MAX + 1);
+		}
+		crcData.config.bitLength = bitLengths[loop % 3];
+		uint32_t mask = 0xFFFFFFFF >> (32 - crcData.config.bitLength);
+		crcData.config.polynomial = (rand() & mask) | 1;
+		crcData.config.initialValue = rand() & mask;
+		crcData.config.finalXorValue = rand() & mask;
+		crcData.config.inputReflected = rand() % (true + 1);
+		crcData.config.resultReflected = rand() % (true + 1);
+		ASSERT_EQ(crcInit(&crcData), 0);
+		ASSERT_EQ(crcHostInit(&crcHost, &crcData.config), 0);
+		uint32_t expected = crcCalcSlow(&crcData, raw, length);
+		ASSERT_EQ(crcHostCalc(&crcHost, raw, length), expected);
+		crcHost.clmul = false;
+		ASSERT_EQ(crcHostCalc(&crcHost, raw, length), expected);
+	}
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(crcTest, crcHostUpdate_pieces) {
+	RecordProperty("description_1", "crcHostUpdate over random pieces, long and short, vs crcCalcSlow over the whole buffer");
+	static uint8_t raw[4096] = {0};
+	for (uint16_t arrayIndex = 0; arrayIndex < arraysize(raw); arrayIndex++) {
+		raw[arrayIndex] = rand() % (UINT8_MAX + 1);
+	}
+	struct structCrcHost crcHost;
+	ASSERT_EQ(crcHostInit(&crcHost, &crcIsoHdlc32.config), 0);
+	ASSERT_EQ(crcHostCalc(&crcHost, raw, arraysize(raw)), crcCalcSlow(&crcIsoHdlc32, raw, arraysize(raw)));
+	ASSERT_EQ(crcHostInit(&crcHost, &crcXmodem16.config), 0);
+	for (uint8_t loop = 0; loop < 20; loop++) {
+		struct structCrcStream stream;
+		crcBegin(&stream, &crcHost.crcData);
+		uint16_t done = 0;
+		while (done < arraysize(raw)) {
+			uint16_t piece = rand() % 300;
+			if (piece > arraysize(raw) - done) {
+				piece = arraysize(raw) - done;
+			}
+			crcHostUpdate(&crcHost, &stream, raw + done, piece);
+			done += piece;
+		}
+		ASSERT_EQ(crcFinal(&stream), crcCalcSlow(&crcXmodem16, raw, arraysize(raw)));
+	}
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
 // SPIQUEUE -----------------------------------------------------------------------------------------------------------------
 
 class spiQueueTest : public ::testing::Test {
@@ -705,6 +910,187 @@ TEST_F(spiQueueTest, spiQueueRemove_three_frame) {
 	ASSERT_EQ(errorVal, ec_no_error);
 }
 
+TEST_F(spiQueueTest, spiQueuePool_full) {
+	RecordProperty("description_1", "Test if the packet pool holds exactly sizemax packets");
+	RecordProperty("description_2", "Test if every packet lies inside the pool");
+	struct structSpiQueue* structSpiQueueReceive = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueReceive, 3), 0);
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	for (uint8_t index = 0; index < 3; index++) {
+		ASSERT_EQ(spiQueuePostArray(structSpiQueueReceive, raw, arraysize(raw), false), 0);
+		ASSERT_GE(structSpiQueueReceive->tailPacketPtr, structSpiQueueReceive->poolPacketPtr);
+		ASSERT_LT(structSpiQueueReceive->tailPacketPtr, structSpiQueueReceive->poolPacketPtr + 3);
+	}
+	ASSERT_TRUE(structSpiQueueReceive->freePacketPtr == NULL);
+	ASSERT_EQ(errorVal, ec_no_error);
+	ASSERT_EQ(spiQueuePostArray(structSpiQueueReceive, raw, arraysize(raw), false), -1);
+	ASSERT_EQ(errorVal, ec_sq_full);
+	ASSERT_EQ(structSpiQueueReceive->sizeCurrent, 3);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueReceive), 0);
+}
+
+TEST_F(spiQueueTest, spiQueuePool_reuse) {
+	RecordProperty("description_1", "Test if removed packets are handed out again by the pool");
+	struct structSpiQueue* structSpiQueueReceive = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueReceive, 2), 0);
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	for (uint16_t loop = 0; loop < 1000; loop++) {
+		raw[SQ_ID_INDEX] = loop;
+		ASSERT_EQ(spiQueuePostArray(structSpiQueueReceive, raw, arraysize(raw), false), 0);
+		ASSERT_EQ(spiQueueGetArray(structSpiQueueReceive, rawGet, arraysize(rawGet)), 0);
+		ASSERT_EQ(rawGet[SQ_ID_INDEX], (uint8_t)loop);
+		ASSERT_EQ(spiQueuePacketRemove(structSpiQueueReceive), 0);
+		ASSERT_EQ(structSpiQueueReceive->sizeCurrent, 0);
+	}
+	ASSERT_TRUE(structSpiQueueReceive->freePacketPtr != NULL);
+	ASSERT_TRUE(structSpiQueueReceive->freePacketPtr->nextPacketPtr != NULL);
+	ASSERT_TRUE(structSpiQueueReceive->freePacketPtr->nextPacketPtr->nextPacketPtr == NULL);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueReceive), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueueModeSet) {
+	RecordProperty("description_1", "Test if the mode can only be changed to a known mode on an empty queue");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	errorReset();
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 4), 0);
+	ASSERT_EQ(structSpiQueueTransmit->mode, SQ_MODE_FIFO);
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX + 1), -1);
+	ASSERT_EQ(errorVal, ec_sq_mode_bad);
+	errorReset();
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 0x12), 0);
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX), -1);
+	ASSERT_EQ(errorVal, ec_sq_mode_bad);
+	ASSERT_EQ(structSpiQueueTransmit->mode, SQ_MODE_FIFO);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiQueueTest, spiQueueMailbox_coalesce) {
+	RecordProperty("description_1", "Test if a pending id is overwritten in place and keeps its turn in mailbox mode");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 3), 0);
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_FRAC64, 1.0), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT32, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	// the queue is full, but every producer loop only refreshes the pending ids
+	for (uint8_t loop = 2; loop < 100; loop++) {
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_FRAC64, (double)loop), 0);
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT32, loop), 0);
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, loop), 0);
+		ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 3);
+	}
+	ASSERT_EQ(errorVal, ec_no_error);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_SINT8, 1), -1);
+	ASSERT_EQ(errorVal, ec_sq_full);
+	errorReset();
+	// the newest value of every id leaves in the order the ids were first posted
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueueGetArray(structSpiQueueTransmit, rawGet, arraysize(rawGet)), 0);
+	ASSERT_EQ(rawGet[SQ_ID_INDEX], ID_TEST_FRAC64);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.frac64, 99.0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->crc.value.uint16, crcCalcFast(&crcData, rawGet, SQ_FRAME_SIZE));
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	// a sent id queues up behind the ids still pending
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_FRAC64, 100.0), 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->identifier, ID_TEST_UINT32);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint32, 99);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->identifier, ID_TEST_UINT8);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 99);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->identifier, ID_TEST_FRAC64);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.frac64, 100.0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueueSchedulerSet) {
+	RecordProperty("description_1", "Test if a scheduler can only be selected on an empty queue with valid weights");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	const uint8_t weights[SQ_PRIO_CLASSES] = {4, 2, 1};
+	const uint8_t weightsBad[SQ_PRIO_CLASSES] = {4, 0, 1};
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_STRICT, NULL), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	errorReset();
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 4), 0);
+	ASSERT_EQ(structSpiQueueTransmit->scheduler, SQ_SCHEDULER_FIFO);
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_WEIGHTED + 1, weights), -1);
+	ASSERT_EQ(errorVal, ec_sq_scheduler_bad);
+	errorReset();
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_WEIGHTED, NULL), -1);
+	ASSERT_EQ(errorVal, ec_sq_scheduler_bad);
+	errorReset();
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_WEIGHTED, weightsBad), -1);
+	ASSERT_EQ(errorVal, ec_sq_scheduler_bad);
+	errorReset();
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_WEIGHTED, weights), 0);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_NORMAL].weight, 2);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 0x12), 0);
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_STRICT, NULL), -1);
+	ASSERT_EQ(errorVal, ec_sq_scheduler_bad);
+	ASSERT_EQ(structSpiQueueTransmit->scheduler, SQ_SCHEDULER_WEIGHTED);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiQueueTest, spiQueuePriority_strict) {
+	RecordProperty("description_1", "Test if higher priority classes overtake lower ones and classes are counted");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 10), 0);
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_STRICT, NULL), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_FILLER, 0), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, 0xA9, 3), 0);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 4);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_HIGH].sizeCurrent, 1);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_NORMAL].sizeCurrent, 2);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_LOW].sizeCurrent, 1);
+	ASSERT_EQ(structSpiQueueTransmit->tailPacketPtr->identifier, 0xA9);
+	const uint8_t order[] = {0xA9, ID_TEST_UINT8, ID_TEST_UINT8, ID_FILLER};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	for (uint8_t index = 0; index < arraysize(order); index++) {
+		ASSERT_EQ(spiQueueGetArray(structSpiQueueTransmit, rawGet, arraysize(rawGet)), 0);
+		ASSERT_EQ(rawGet[SQ_ID_INDEX], order[index]);
+		ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	}
+	ASSERT_TRUE(structSpiQueueTransmit->headPacketPtr == NULL);
+	ASSERT_TRUE(structSpiQueueTransmit->tailPacketPtr == NULL);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_NORMAL].sizeCurrent, 0);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_NORMAL].sizePeak, 2);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueuePriority_weighted) {
+	RecordProperty("description_1", "Test if every class gets its weighted share so lower classes don't starve");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	const uint8_t weights[SQ_PRIO_CLASSES] = {2, 1, 1};
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 20), 0);
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_WEIGHTED, weights), 0);
+	for (uint8_t index = 0; index < 3; index++) {
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_FILLER, 0), 0);
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, index), 0);
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, 0xA9, 2 * index), 0);
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, 0xA9, 2 * index + 1), 0);
+	}
+	const uint8_t order[] = {0xA9, 0xA9, ID_TEST_UINT8, ID_FILLER};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	for (uint8_t round = 0; round < 3; round++) {
+		for (uint8_t index = 0; index < arraysize(order); index++) {
+			ASSERT_EQ(spiQueueGetArray(structSpiQueueTransmit, rawGet, arraysize(rawGet)), 0);
+			ASSERT_EQ(rawGet[SQ_ID_INDEX], order[index]);
+			ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+		}
+	}
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
 TEST_F(spiQueueTest, spiQueueGetArray) {
 	RecordProperty("description_1", "Test returning frame as raw array");
 	struct structSpiQueue* structSpiQueueReceive = NULL;
@@ -718,6 +1104,379 @@ TEST_F(spiQueueTest, spiQueueGetArray) {
 	ASSERT_EQ(errorVal, ec_no_error);
 }
 
+TEST_F(spiQueueTest, spiQueueMetrics) {
+	RecordProperty("description_1", "Test if posts, gets, drops, depth and dwell time are counted");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiQueueMetrics metrics;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 3), 0);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.posts, 0);
+	ASSERT_EQ(metrics.dwellMin, 0);
+	ASSERT_EQ(metrics.dwellMean, 0);
+	spiQueueCycles = 1000;
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	spiQueueCycles = 1010;
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 3), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 4), -1);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 300), -1);
+	uint8_t raw[SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueuePostArray(structSpiQueueTransmit, raw, SQ_PACKET_SIZE - 1, false), -1);
+	spiQueueCycles = 1100;
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	spiQueueCycles = 1200;
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.posts, 3);
+	ASSERT_EQ(metrics.gets, 2);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 1);
+	ASSERT_EQ(metrics.drops[SQ_DROP_ENCODE], 1);
+	ASSERT_EQ(metrics.drops[SQ_DROP_LENGTH], 1);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OVERWRITE], 0);
+	ASSERT_EQ(metrics.sizeCurrent, 1);
+	ASSERT_EQ(metrics.sizePeak, 3);
+	ASSERT_EQ(metrics.dwellMin, 100);
+	ASSERT_EQ(metrics.dwellMax, 190);
+	ASSERT_EQ(metrics.dwellMean, 145);
+	ASSERT_EQ(spiQueueMetricsReset(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.posts, 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 0);
+	ASSERT_EQ(metrics.sizePeak, 1);
+	ASSERT_EQ(metrics.dwellMax, 0);
+	// the cycle counter may wrap while a packet is waiting
+	spiQueueCycles = 5;
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.dwellMax, UINT32_MAX - 1010 + 6);
+	ASSERT_EQ(spiQueueMetricsGet(NULL, &metrics), -1);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	spiQueueCycles = 0;
+}
+
+TEST_F(spiQueueTest, spiQueueMetrics_mailbox_overwrite) {
+	RecordProperty("description_1", "Test if overwritten mailbox values are counted as drops and keep their dwell time");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiQueueMetrics metrics;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 3), 0);
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX), 0);
+	spiQueueCycles = 10;
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	spiQueueCycles = 20;
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT16};
+	const double values[] = {2, 3};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, values, arraysize(ids)), 0);
+	// the pending id needs no room, the two new ones do not fit the last free packet
+	const uint8_t idsFull[] = {ID_TEST_UINT16, ID_TEST_UINT32, ID_TEST_SINT8};
+	const double valuesFull[] = {4, 5, 6};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, idsFull, valuesFull, arraysize(idsFull)), -1);
+	spiQueueCycles = 50;
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.posts, 3);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OVERWRITE], 1);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 2);
+	ASSERT_EQ(metrics.dwellMax, 40);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	spiQueueCycles = 0;
+}
+
+TEST_F(spiQueueTest, spiQueueOverflowSet) {
+	RecordProperty("description_1", "Test if the overflow policy can only be set on an empty spiqueue");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_DROP_OLDEST, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 3), 0);
+	ASSERT_EQ(structSpiQueueTransmit->overflow, SQ_OVERFLOW_DROP_NEWEST);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_BLOCK + 1, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_overflow_bad);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_BLOCK, 5), 0);
+	ASSERT_EQ(structSpiQueueTransmit->timeout, 5);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_DROP_OLDEST, 0), -1);
+	ASSERT_EQ(structSpiQueueTransmit->overflow, SQ_OVERFLOW_BLOCK);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiQueueTest, spiQueueOverflow_drop_newest) {
+	RecordProperty("description_1", "Test if a full spiqueue rejects new frames and counts them");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiQueueMetrics metrics;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 3), -1);
+	ASSERT_EQ(errorVal, ec_sq_full);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 1);
+	ASSERT_EQ(structSpiQueueTransmit->tailPacketPtr->payload.uint8[0], 2);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 1);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiQueueTest, spiQueueOverflow_drop_oldest) {
+	RecordProperty("description_1", "Test if a full spiqueue drops its oldest packet for a new frame");
+	RecordProperty("description_2", "Test if packets of a higher class are never dropped for a lower one");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiQueueMetrics metrics;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 3), 0);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_DROP_OLDEST, 0), 0);
+	for (uint8_t value = 1; value <= 5; value++) {
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, value), 0);
+	}
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 3);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 3);
+	ASSERT_EQ(structSpiQueueTransmit->tailPacketPtr->payload.uint8[0], 5);
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT8};
+	const double values[] = {6, 7};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, values, arraysize(ids)), 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 5);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OLDEST], 4);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	// high class 0xa9, normal class test ids, low class filler
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 2), 0);
+	ASSERT_EQ(spiQueueSchedulerSet(structSpiQueueTransmit, SQ_SCHEDULER_STRICT, NULL), 0);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_DROP_OLDEST, 0), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_FILLER, 0), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, 0xA9, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 2), 0);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_LOW].sizeCurrent, 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_FILLER, 3), -1);
+	ASSERT_EQ(errorVal, ec_sq_full);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, 0xA9, 4), 0);
+	ASSERT_EQ(structSpiQueueTransmit->classes[SQ_PRIO_NORMAL].sizeCurrent, 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint32, 1);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OLDEST], 2);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 1);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+static uint8_t spiQueueWaitCalls = 0;
+
+static bool spiQueueWaitRemove(struct structSpiQueue* structSpiQueuePtrArg, uint32_t) {
+	// acts as the consumer task that gets a packet while the producer is blocked
+	spiQueueWaitCalls++;
+	return spiQueuePacketRemove(structSpiQueuePtrArg) == 0;
+}
+
+TEST_F(spiQueueTest, spiQueueOverflow_block) {
+	RecordProperty("description_1", "Test if a blocked post continues once a get made room");
+	RecordProperty("description_2", "Test if a blocked post without a get times out and is counted");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiQueueMetrics metrics;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 2), 0);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_BLOCK, 10), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 3), -1);
+	ASSERT_EQ(errorVal, ec_sq_full);
+	errorReset();
+	spiQueueWaitHook = spiQueueWaitRemove;
+	spiQueueWaitCalls = 0;
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 4), 0);
+	ASSERT_EQ(spiQueueWaitCalls, 1);
+	ASSERT_TRUE(structSpiQueueTransmit->waitingTaskPtr == NULL);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 2);
+	ASSERT_EQ(structSpiQueueTransmit->tailPacketPtr->payload.uint8[0], 4);
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT8};
+	const double values[] = {5, 6};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, values, arraysize(ids)), 0);
+	ASSERT_EQ(spiQueueWaitCalls, 3);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 5);
+	spiQueueWaitHook = NULL;
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.blocks, 3);
+	ASSERT_EQ(metrics.drops[SQ_DROP_TIMEOUT], 1);
+	ASSERT_EQ(metrics.drops[SQ_DROP_FULL], 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+static uint8_t spiQueueNotifyCalls = 0;
+
+static void spiQueueNotifyCount(void* taskArg) {
+	// acts as the task notification, only the consumer task may be woken
+	ASSERT_TRUE(taskArg == (void*)2);
+	spiQueueNotifyCalls++;
+}
+
+TEST_F(spiQueueTest, spiQueueConsumerSet_notify) {
+	RecordProperty("description_1", "Test if the consumer is woken once when a post fills the empty queue and not by its own posts");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueueConsumerSet(structSpiQueueTransmit, (void*)2), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	errorReset();
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 10), 0);
+	spiQueueNotifyHook = spiQueueNotifyCount;
+	spiQueueNotifyCalls = 0;
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	ASSERT_EQ(spiQueueNotifyCalls, 0);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueueConsumerSet(structSpiQueueTransmit, (void*)2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 3), 0);
+	ASSERT_EQ(spiQueueNotifyCalls, 1);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT8};
+	const double values[] = {4, 5};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, values, arraysize(ids)), 0);
+	ASSERT_EQ(spiQueueNotifyCalls, 2);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	ASSERT_EQ(spiQueuePacketRemove(structSpiQueueTransmit), 0);
+	// the consumer itself posts the filler of an empty queue
+	ASSERT_EQ(spiQueueConsumerSet(structSpiQueueTransmit, SQ_TASK()), 0);
+	ASSERT_EQ(spiQueueGetArray(structSpiQueueTransmit, rawGet, arraysize(rawGet)), 0);
+	ASSERT_EQ(rawGet[SQ_ID_INDEX], ID_FILLER);
+	ASSERT_EQ(spiQueueNotifyCalls, 2);
+	spiQueueNotifyHook = NULL;
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueuePostMany) {
+	RecordProperty("description_1", "Test if a batch post gives the same frames as single posts");
+	struct structSpiQueue* structSpiQueueSingle = NULL;
+	struct structSpiQueue* structSpiQueueBatch = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueSingle, 10), 0);
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueBatch, 10), 0);
+	const uint8_t ids[] = {ID_TEST_FRAC64, ID_TEST_FRAC32, ID_TEST_UINT16, ID_TEST_SINT8, ID_TEST_BINARY};
+	const double values[] = {-12.5, 3.25, 1234, -100, 1};
+	ASSERT_EQ(spiQueuePost(structSpiQueueSingle, ID_TEST_FRAC64, -12.5), 0);
+	ASSERT_EQ(spiQueuePostFrac(structSpiQueueSingle, ID_TEST_FRAC32, 3.25), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueSingle, ID_TEST_UINT16, 1234), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueSingle, ID_TEST_SINT8, -100), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueSingle, ID_TEST_BINARY, 1), 0);
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueBatch, ids, values, arraysize(ids)), 0);
+	ASSERT_EQ(structSpiQueueBatch->sizeCurrent, arraysize(ids));
+	ASSERT_EQ(structSpiQueueBatch->tailPacketPtr->identifier, ID_TEST_BINARY);
+	uint8_t rawSingle[SQ_PACKET_SIZE] = {0};
+	uint8_t rawBatch[SQ_PACKET_SIZE] = {0};
+	for (uint8_t index = 0; index < arraysize(ids); index++) {
+		ASSERT_EQ(spiQueueGetArray(structSpiQueueSingle, rawSingle, arraysize(rawSingle)), 0);
+		ASSERT_EQ(spiQueueGetArray(structSpiQueueBatch, rawBatch, arraysize(rawBatch)), 0);
+		ASSERT_EQ(memcmp(rawSingle, rawBatch, SQ_PACKET_SIZE), 0);
+		ASSERT_EQ(spiQueuePacketRemove(structSpiQueueSingle), 0);
+		ASSERT_EQ(spiQueuePacketRemove(structSpiQueueBatch), 0);
+	}
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueSingle), 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueBatch), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueuePostMany_all_or_nothing) {
+	RecordProperty("description_1", "Test if a batch with a bad value or without room leaves the queue untouched");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 3), 0);
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT8, ID_TEST_UINT8};
+	const double values[] = {1, 2, 300};
+	struct structPacket* freePacketPtr = structSpiQueueTransmit->freePacketPtr;
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, values, arraysize(ids)), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_uint8);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 0);
+	ASSERT_TRUE(structSpiQueueTransmit->headPacketPtr == NULL);
+	ASSERT_EQ(structSpiQueueTransmit->freePacketPtr, freePacketPtr);
+	errorReset();
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 0), 0);
+	const double valuesGood[] = {1, 2, 3};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, valuesGood, arraysize(ids)), -1);
+	ASSERT_EQ(errorVal, ec_sq_full);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 1);
+	ASSERT_EQ(spiQueuePostMany(NULL, ids, values, arraysize(ids)), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist_post);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiQueueTest, spiQueuePostMany_mailbox) {
+	RecordProperty("description_1", "Test if a batch overwrites pending ids in mailbox mode");
+	RecordProperty("description_2", "Test if ids that are pending or repeated in the batch need no free packet of their own");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 2), 0);
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX), 0);
+	const uint8_t ids[] = {ID_TEST_FRAC64, ID_TEST_UINT32, ID_TEST_FRAC64};
+	const double values[] = {1.5, 7, 2.5};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, values, arraysize(ids)), 0);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 2);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.frac64, 2.5);
+	const double valuesNew[] = {3.5, 8, 4.5};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, valuesNew, arraysize(ids)), 0);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 2);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.frac64, 4.5);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->nextPacketPtr->payload.uint32, 8);
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueueGetArray(structSpiQueueTransmit, rawGet, arraysize(rawGet)), 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->crc.value.uint16, crcCalcFast(&crcData, rawGet, SQ_FRAME_SIZE));
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueuePostMany_drop_oldest) {
+	RecordProperty("description_1", "Test if a batch that fails to encode drops no older packets");
+	RecordProperty("description_2", "Test if a full mailbox overwrites pending ids in place instead of dropping them");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiQueueMetrics metrics;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 2), 0);
+	ASSERT_EQ(spiQueueModeSet(structSpiQueueTransmit, SQ_MODE_MAILBOX), 0);
+	ASSERT_EQ(spiQueueOverflowSet(structSpiQueueTransmit, SQ_OVERFLOW_DROP_OLDEST, 0), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT16, 2), 0);
+	const uint8_t ids[] = {ID_TEST_UINT32, ID_TEST_UINT8};
+	const double valuesBad[] = {3, 300};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, ids, valuesBad, arraysize(ids)), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_uint8);
+	errorReset();
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 2);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 1);
+	const uint8_t idsPending[] = {ID_TEST_UINT16, ID_TEST_UINT8};
+	const double valuesPending[] = {4, 5};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, idsPending, valuesPending, arraysize(idsPending)), 0);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->identifier, ID_TEST_UINT8);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->payload.uint8[0], 5);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OLDEST], 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OVERWRITE], 2);
+	// the oldest packet is pending for the batch, once it is dropped its id needs room as well
+	const double values[] = {6, 7};
+	const uint8_t idsMixed[] = {ID_TEST_UINT8, ID_TEST_UINT32};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueTransmit, idsMixed, values, arraysize(idsMixed)), 0);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 2);
+	ASSERT_EQ(structSpiQueueTransmit->headPacketPtr->identifier, ID_TEST_UINT8);
+	ASSERT_EQ(structSpiQueueTransmit->tailPacketPtr->payload.uint32, 7);
+	ASSERT_EQ(spiQueueMetricsGet(structSpiQueueTransmit, &metrics), 0);
+	ASSERT_EQ(metrics.drops[SQ_DROP_OLDEST], 2);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiQueueTest, spiQueueGetBurst) {
+	RecordProperty("description_1", "Test if a burst moves frames in order into one array and removes them");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 10), 0);
+	uint8_t burst[4 * SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, burst, 4), 0);
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	for (uint8_t index = 0; index < 6; index++) {
+		raw[SQ_ID_INDEX] = 0x10 + index;
+		ASSERT_EQ(spiQueuePostArray(structSpiQueueTransmit, raw, arraysize(raw), false), 0);
+	}
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, burst, 4), 4);
+	for (uint8_t index = 0; index < 4; index++) {
+		ASSERT_EQ(burst[index * SQ_PACKET_SIZE + SQ_ID_INDEX], 0x10 + index);
+		ASSERT_EQ(memcmp(burst + index * SQ_PACKET_SIZE + SQ_PAYLOAD_INDEX, raw + SQ_PAYLOAD_INDEX, SQ_PACKET_SIZE - SQ_PAYLOAD_INDEX), 0);
+	}
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 2);
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, burst, 4), 2);
+	ASSERT_EQ(burst[SQ_PACKET_SIZE + SQ_ID_INDEX], 0x15);
+	ASSERT_TRUE(structSpiQueueTransmit->headPacketPtr == NULL);
+	ASSERT_EQ(spiQueueGetBurst(NULL, burst, 4), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
 TEST_F(spiQueueTest, spiQueuePost_uint8_normal) {
 	RecordProperty("description_1", "Test appending frame using ID and value [UINT8]");
 	struct structSpiQueue* structSpiQueueReceive = NULL;
@@ -1151,46 +1910,1250 @@ TEST_F(spiQueueTest, spiQueuePost_bool_true) {
 	ASSERT_EQ(errorVal, ec_no_error);
 }
 
-TEST_F(spiQueueTest, spiQueueProcessAck_placeholder) {
-	RecordProperty("description_1", "placeholder");
+TEST_F(spiQueueTest, spiQueuePost_unknown_id) {
+	RecordProperty("description_1", "Test appending frame using an ID without a lexicon entry, including the last ID below 0xFF");
 	struct structSpiQueue* structSpiQueueReceive = NULL;
 	ASSERT_EQ(spiQueueCreate(&structSpiQueueReceive, 10), 0);
-	struct structSpiQueue* structSpiQueueTransmit = NULL;
-	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 10), 0);
-	ASSERT_EQ(spiQueueProcessAck(structSpiQueueTransmit, structSpiQueueReceive, false), -1);
+	// the lookup reports ec_sq_bad_id, the encoder then reports the missing datatype
+	ASSERT_EQ(spiQueuePost(structSpiQueueReceive, 0x10, 1), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_no_datatype);
+	errorVal = ec_no_error;
+	ASSERT_EQ(spiQueuePost(structSpiQueueReceive, 0xFE, 1), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_no_datatype);
+	errorVal = ec_no_error;
+	const uint8_t ids[] = {ID_TEST_UINT8, 0x10};
+	const double values[] = {1, 1};
+	ASSERT_EQ(spiQueuePostMany(structSpiQueueReceive, ids, values, arraysize(ids)), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_no_datatype);
+	ASSERT_EQ(structSpiQueueReceive->sizeCurrent, 0);
 	ASSERT_EQ(spiQueueRemove(&structSpiQueueReceive), 0);
-	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
-	ASSERT_EQ(errorVal, ec_sq_not_implemented);
 }
 
-TEST_F(spiQueueTest, spiQueueNoDuplicate) {
-	RecordProperty("description_1", "test spiQueueNoDuplicate by varying two inputs");
-	bool noDuplicate = false;
+TEST_F(spiQueueTest, spiQueuePost_lexicon_ids) {
+	RecordProperty("description_1", "Test that every ID generated from the lexicon is accepted and keeps its row value");
+	struct structSpiQueue* structSpiQueueReceive = NULL;
+	const uint8_t ids[] = {ID_FILLER, ID_LATENCY, ID_SETPOINT_BATTERY_1, ID_SETPOINT_DG_2, ID_POWER_BATTERY_1, ID_SOC_BATTERY_2, ID_POWER_DG_1, ID_SFOC_DG_2, ID_OPSTATE};
+	ASSERT_EQ(ID_LATENCY, 0xA9);
+	ASSERT_EQ(ID_SETPOINT_BATTERY_1, 0xB1);
+	ASSERT_EQ(ID_OPSTATE, 0xC9);
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueReceive, arraysize(ids)), 0);
+	for (uint8_t index = 0; index < arraysize(ids); index++) {
+		ASSERT_EQ(spiQueuePost(structSpiQueueReceive, ids[index], 1), 0);
+	}
+	ASSERT_EQ(structSpiQueueReceive->sizeCurrent, arraysize(ids));
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueReceive), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+// SPIRING ------------------------------------------------------------------------------------------------------------------
+
+class spiRingTest : public ::testing::Test {
+  protected:
+	spiRingTest() {
+		errorReset();
+	}
+};
+
+TEST_F(spiRingTest, spiRingCreate) {
+	RecordProperty("description_1", "Test creation and removal of an empty ring");
+	struct structSpiRing* structSpiRingTransmit = NULL;
+	ASSERT_EQ(spiRingCreate(&structSpiRingTransmit, 8), 0);
+	ASSERT_EQ(structSpiRingTransmit->mask, 7);
+	ASSERT_EQ(spiRingSizeCurrent(structSpiRingTransmit), 0);
+	ASSERT_EQ(spiRingCreate(&structSpiRingTransmit, 8), -1);
+	ASSERT_EQ(errorVal, ec_sq_already_exist);
+	ASSERT_EQ(spiRingRemove(&structSpiRingTransmit), 0);
+	ASSERT_TRUE(structSpiRingTransmit == NULL);
+	ASSERT_EQ(spiRingRemove(&structSpiRingTransmit), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+}
+
+TEST_F(spiRingTest, spiRingCreate_size_bad) {
+	RecordProperty("description_1", "Test if a ring refuses a size that is not a power of two");
+	struct structSpiRing* structSpiRingTransmit = NULL;
+	ASSERT_EQ(spiRingCreate(&structSpiRingTransmit, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_ring_size_bad);
+	errorReset();
+	ASSERT_EQ(spiRingCreate(&structSpiRingTransmit, 100), -1);
+	ASSERT_EQ(errorVal, ec_sq_ring_size_bad);
+	ASSERT_TRUE(structSpiRingTransmit == NULL);
+}
+
+TEST_F(spiRingTest, spiRingPostArray_order) {
+	RecordProperty("description_1", "Test if frames leave the ring in the order they were posted");
+	struct structSpiRing* structSpiRingTransmit = NULL;
+	ASSERT_EQ(spiRingCreate(&structSpiRingTransmit, 4), 0);
 	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
-	uint8_t raw2[SQ_PACKET_SIZE] = {0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D};
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, true);
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, false);
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, false);
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw2, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, true);
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw2, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, false);
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, true);
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw2, SQ_PACKET_SIZE), 0);
-	ASSERT_EQ(noDuplicate, true);
-	ASSERT_EQ(errorVal, ec_no_error);
-}
-
-TEST_F(spiQueueTest, spiQueueNoDuplicate_bad_length) {
-	RecordProperty("description_1", "test spiQueueNoDuplicate for incorrect input length");
-	bool noDuplicate = false;
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiRingGetArray(structSpiRingTransmit, rawGet, arraysize(rawGet)), -1);
+	for (uint8_t loop = 0; loop < 10; loop++) {
+		for (uint8_t index = 0; index < 3; index++) {
+			raw[SQ_ID_INDEX] = loop * 3 + index;
+			ASSERT_EQ(spiRingPostArray(structSpiRingTransmit, raw, arraysize(raw)), 0);
+		}
+		ASSERT_EQ(spiRingSizeCurrent(structSpiRingTransmit), 3);
+		for (uint8_t index = 0; index < 3; index++) {
+			ASSERT_EQ(spiRingGetArray(structSpiRingTransmit, rawGet, arraysize(rawGet)), 0);
+			ASSERT_EQ(rawGet[SQ_ID_INDEX], loop * 3 + index);
+			ASSERT_EQ(memcmp(raw + SQ_PAYLOAD_INDEX, rawGet + SQ_PAYLOAD_INDEX, SQ_PACKET_SIZE - SQ_PAYLOAD_INDEX), 0);
+		}
+		ASSERT_EQ(spiRingGetArray(structSpiRingTransmit, rawGet, arraysize(rawGet)), -1);
+	}
+	ASSERT_EQ(spiRingPostArray(structSpiRingTransmit, raw, SQ_PACKET_SIZE + 1), -1);
+	ASSERT_EQ(spiRingRemove(&structSpiRingTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiRingTest, spiRingPostArray_full) {
+	RecordProperty("description_1", "Test if a full ring drops new frames and counts them");
+	struct structSpiRing* structSpiRingTransmit = NULL;
+	ASSERT_EQ(spiRingCreate(&structSpiRingTransmit, 4), 0);
+	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	for (uint8_t index = 0; index < 4; index++) {
+		ASSERT_EQ(spiRingPostArray(structSpiRingTransmit, raw, arraysize(raw)), 0);
+	}
+	ASSERT_EQ(spiRingPostArray(structSpiRingTransmit, raw, arraysize(raw)), -1);
+	ASSERT_EQ(spiRingPostArray(structSpiRingTransmit, raw, arraysize(raw)), -1);
+	ASSERT_EQ(structSpiRingTransmit->dropCount, 2);
+	ASSERT_EQ(spiRingGetArray(structSpiRingTransmit, rawGet, arraysize(rawGet)), 0);
+	ASSERT_EQ(spiRingPostArray(structSpiRingTransmit, raw, arraysize(raw)), 0);
+	ASSERT_EQ(spiRingSizeCurrent(structSpiRingTransmit), 4);
+	ASSERT_EQ(spiRingRemove(&structSpiRingTransmit), 0);
+}
+
+TEST_F(spiRingTest, spiRingReserve_zero_copy) {
+	RecordProperty("description_1", "Test if a frame written straight into a reserved slot is handed to the consumer in place");
+	struct structSpiRing* structSpiRingReceive = NULL;
+	ASSERT_EQ(spiRingCreate(&structSpiRingReceive, 2), 0);
 	uint8_t raw[SQ_PACKET_SIZE] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
-	ASSERT_EQ(spiQueueNoDuplicate(&noDuplicate, raw, SQ_PACKET_SIZE + 1), -1);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == NULL);
+	ASSERT_EQ(spiRingRelease(structSpiRingReceive), -1);
+	uint8_t* slotFrame = spiRingReserve(structSpiRingReceive);
+	ASSERT_TRUE(slotFrame != NULL);
+	ASSERT_EQ((uintptr_t)slotFrame % sizeof(uint32_t), 0);
+	// a reserved slot stays invisible until it is committed, like a dma transfer still in flight
+	memcpy(slotFrame, raw, SQ_PACKET_SIZE);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == NULL);
+	spiRingCommit(slotFrame);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == slotFrame);
+	ASSERT_EQ(spiFrameGetId(spiRingPeek(structSpiRingReceive)), 0x01);
+	ASSERT_EQ(spiRingRelease(structSpiRingReceive), 0);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == NULL);
+	// the consumer only sees frames that were committed, in claim order
+	uint8_t* firstFrame = spiRingReserve(structSpiRingReceive);
+	uint8_t* secondFrame = spiRingReserve(structSpiRingReceive);
+	ASSERT_TRUE(spiRingReserve(structSpiRingReceive) == NULL);
+	ASSERT_EQ(structSpiRingReceive->dropCount, 1);
+	spiRingCommit(secondFrame);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == NULL);
+	spiRingCommit(firstFrame);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == firstFrame);
+	ASSERT_EQ(spiRingRelease(structSpiRingReceive), 0);
+	ASSERT_TRUE(spiRingPeek(structSpiRingReceive) == secondFrame);
+	ASSERT_EQ(spiRingRelease(structSpiRingReceive), 0);
+	ASSERT_EQ(spiRingRemove(&structSpiRingReceive), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiRingTest, spiFrame_accessors) {
+	RecordProperty("description_1", "Test if the frame accessors decode a frame in wire layout like spiqueuepostarray does");
+	crcData.config.bitLength = 16;
+	crcData.config.polynomial = X(12) + X(5) + X(0);
+	crcInit(&crcData);
+	struct structSpiQueue* structSpiQueueReceive = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueReceive, 1), 0);
+	alignas(uint32_t) uint8_t raw[SQ_SLOT_SIZE] = {0xAA, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x34, 0x12};
+	union unionCrc crc;
+	crc.uint16 = GETCRC(raw);
+	memcpy(raw + SQ_CRC_INDEX, crc.uint8, SQ_CRC_SIZE);
+	ASSERT_EQ(spiQueuePostArray(structSpiQueueReceive, raw, SQ_PACKET_SIZE, true), 0);
+	struct structPacket* packet = structSpiQueueReceive->headPacketPtr;
+	ASSERT_EQ(spiFrameGetId(raw), packet->identifier);
+	ASSERT_EQ(spiFrameGetPayload(raw).uint32, packet->payload.uint32);
+	ASSERT_EQ(spiFrameGetPayload(raw).frac64, packet->payload.frac64);
+	ASSERT_EQ(spiFrameGetAck(raw), packet->ack.returnCrc.uint16);
+	ASSERT_EQ(spiFrameGetCrc(raw), packet->crc.value.uint16);
+	ASSERT_TRUE(spiFrameCrcGood(raw));
+	ASSERT_TRUE(packet->crc.good);
+	raw[SQ_PAYLOAD_INDEX] ^= 0x01;
+	ASSERT_FALSE(spiFrameCrcGood(raw));
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueReceive), 0);
+}
+
+/** @brief amount of producer threads in the stress test */
+#define STRESS_PRODUCERS 4
+/** @brief amount of frames posted by every producer thread */
+#define STRESS_FRAMES 1000000
+
+/** @brief ring shared by the stress test threads */
+static struct structSpiRing* stressRing = NULL;
+
+/**
+ * @brief producer thread posting STRESS_FRAMES numbered frames
+ * @param[in] argument producer index
+ */
+static void* stressProducer(void* argument) {
+	uint8_t raw[SQ_PACKET_SIZE] = {0};
+	union unionPayload payload = {0};
+	raw[SQ_ID_INDEX] = (uint8_t)(uintptr_t)argument;
+	for (uint32_t frame = 0; frame < STRESS_FRAMES; frame++) {
+		payload.uint32 = frame;
+		memcpy(raw + SQ_PAYLOAD_INDEX, payload.uint8, SQ_PAYLOAD_SIZE);
+		while (spiRingPostArray(stressRing, raw, arraysize(raw)) != 0) {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+TEST_F(spiRingTest, spiRing_stress) {
+	RecordProperty("description_1", "Test multiple producer threads against a single consumer");
+	RecordProperty("description_2", "Every frame must arrive exactly once and in order per producer");
+	ASSERT_EQ(spiRingCreate(&stressRing, 256), 0);
+	pthread_t producers[STRESS_PRODUCERS];
+	uint32_t expected[STRESS_PRODUCERS] = {0};
+	uint8_t rawGet[SQ_PACKET_SIZE] = {0};
+	union unionPayload payload = {0};
+	struct timespec start, stop;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uintptr_t index = 0; index < STRESS_PRODUCERS; index++) {
+		ASSERT_EQ(pthread_create(&producers[index], NULL, stressProducer, (void*)index), 0);
+	}
+	for (uint32_t received = 0; received < STRESS_PRODUCERS * STRESS_FRAMES;) {
+		if (spiRingGetArray(stressRing, rawGet, arraysize(rawGet)) != 0) {
+			sched_yield();
+			continue;
+		}
+		ASSERT_LT(rawGet[SQ_ID_INDEX], STRESS_PRODUCERS);
+		memcpy(payload.uint8, rawGet + SQ_PAYLOAD_INDEX, SQ_PAYLOAD_SIZE);
+		// a lost frame shows up as a gap, a duplicated frame as a repeat
+		ASSERT_EQ(payload.uint32, expected[rawGet[SQ_ID_INDEX]]);
+		expected[rawGet[SQ_ID_INDEX]]++;
+		received++;
+	}
+	for (uint8_t index = 0; index < STRESS_PRODUCERS; index++) {
+		pthread_join(producers[index], NULL);
+		ASSERT_EQ(expected[index], STRESS_FRAMES);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	ASSERT_EQ(spiRingGetArray(stressRing, rawGet, arraysize(rawGet)), -1);
+	ASSERT_EQ(spiRingSizeCurrent(stressRing), 0);
+	double seconds = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+	double operations = 2.0 * STRESS_PRODUCERS * STRESS_FRAMES / seconds;
+	RecordProperty("operations_per_second", std::to_string((uint64_t)operations));
+	printf("spiring: %.2f million post+get operations per second\n", operations / 1e6);
+	ASSERT_EQ(spiRingRemove(&stressRing), 0);
+}
+
+// SPISTREAM ----------------------------------------------------------------------------------------------------------------
+
+class spiStreamTest : public ::testing::Test {
+  protected:
+	spiStreamTest() {
+		errorReset();
+	}
+};
+
+/**
+ * @brief emulates the circular dma of spi1 over one half with a loopback wire and calls the matching callback
+ * @param[in] streamArg spistream the dma runs over
+ * @param[in,out] dmaHalfArg halves run by the dma so far
+ */
+static void spiStreamDmaHalf(struct structSpiStream* streamArg, uint32_t* dmaHalfArg) {
+	uint8_t half = *dmaHalfArg & 1;
+	// the slave echoes what it clocks in, so every frame sent comes back in the same position
+	memcpy(streamArg->receivePtr + half * streamArg->halfSize, streamArg->transmitPtr + half * streamArg->halfSize, streamArg->halfSize);
+	(*dmaHalfArg)++;
+	// half transfer callback for the first half, transfer complete callback for the second
+	spiStreamHalfDone(streamArg, half);
+}
+
+TEST_F(spiStreamTest, spiStreamCreate) {
+	RecordProperty("description_1", "Test creation and removal of a stream with both transmit halves filled with filler frames");
+	struct structSpiStream* structSpiStreamLink = NULL;
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_stream_size_bad);
+	errorReset();
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 3), 0);
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 3), -1);
+	ASSERT_EQ(errorVal, ec_sq_already_exist);
+	errorReset();
+	ASSERT_EQ(structSpiStreamLink->halfSize, 3 * SQ_PACKET_SIZE);
+	ASSERT_EQ((uintptr_t)structSpiStreamLink->receivePtr % sizeof(uint32_t), 0);
+	for (uint8_t index = 0; index < 6; index++) {
+		uint8_t* frame = structSpiStreamLink->transmitPtr + index * SQ_PACKET_SIZE;
+		ASSERT_EQ(spiFrameGetId(frame), ID_FILLER);
+		ASSERT_TRUE(spiFrameCrcGood(frame));
+	}
+	uint8_t* transmit = NULL;
+	ASSERT_TRUE(spiStreamTake(structSpiStreamLink, &transmit) == NULL);
+	ASSERT_EQ(spiStreamGive(structSpiStreamLink), -1);
+	ASSERT_EQ(spiStreamRemove(&structSpiStreamLink), 0);
+	ASSERT_TRUE(structSpiStreamLink == NULL);
+	ASSERT_EQ(spiStreamRemove(&structSpiStreamLink), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+}
+
+TEST_F(spiStreamTest, spiStream_swap) {
+	RecordProperty("description_1", "Test if every queued frame crosses the emulated circular dma once and in order when the consumer keeps up");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiStream* structSpiStreamLink = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 100), 0);
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 4), 0);
+	uint32_t dmaHalf = 0;
+	uint32_t posted = 0;
+	uint32_t received = 0;
+	for (uint16_t round = 0; round < 200; round++) {
+		// a varying amount of frames per half, sometimes more than a half holds
+		for (uint8_t index = 0; index < round % 7; index++) {
+			ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT32, posted++), 0);
+		}
+		spiStreamDmaHalf(structSpiStreamLink, &dmaHalf);
+		uint8_t* transmit = NULL;
+		uint8_t* receive = spiStreamTake(structSpiStreamLink, &transmit);
+		ASSERT_TRUE(receive != NULL);
+		ASSERT_EQ(receive - structSpiStreamLink->receivePtr, transmit - structSpiStreamLink->transmitPtr);
+		ASSERT_EQ(receive - structSpiStreamLink->receivePtr, ((dmaHalf - 1) & 1) * structSpiStreamLink->halfSize);
+		for (uint8_t index = 0; index < structSpiStreamLink->framesHalf; index++) {
+			uint8_t* frame = receive + index * SQ_PACKET_SIZE;
+			ASSERT_TRUE(spiFrameCrcGood(frame));
+			if (spiFrameGetId(frame) == ID_TEST_UINT32) {
+				ASSERT_EQ(spiFrameGetPayload(frame).uint32, received++);
+			} else {
+				ASSERT_EQ(spiFrameGetId(frame), ID_FILLER);
+			}
+		}
+		ASSERT_GE(spiStreamFill(structSpiStreamLink, transmit, structSpiQueueTransmit), 0);
+		ASSERT_EQ(spiStreamGive(structSpiStreamLink), 0);
+		ASSERT_TRUE(spiStreamTake(structSpiStreamLink, &transmit) == NULL);
+	}
+	// drain what is still queued or in flight
+	while (received < posted) {
+		spiStreamDmaHalf(structSpiStreamLink, &dmaHalf);
+		uint8_t* transmit = NULL;
+		uint8_t* receive = spiStreamTake(structSpiStreamLink, &transmit);
+		for (uint8_t index = 0; index < structSpiStreamLink->framesHalf; index++) {
+			uint8_t* frame = receive + index * SQ_PACKET_SIZE;
+			if (spiFrameGetId(frame) == ID_TEST_UINT32) {
+				ASSERT_EQ(spiFrameGetPayload(frame).uint32, received++);
+			}
+		}
+		ASSERT_GE(spiStreamFill(structSpiStreamLink, transmit, structSpiQueueTransmit), 0);
+		ASSERT_EQ(spiStreamGive(structSpiStreamLink), 0);
+		ASSERT_LT(dmaHalf, 1000);
+	}
+	ASSERT_EQ(structSpiStreamLink->overrunCount, 0);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 0);
+	ASSERT_EQ(spiStreamRemove(&structSpiStreamLink), 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiStreamTest, spiStream_overrun) {
+	RecordProperty("description_1", "Test if a consumer falling behind the emulated dma gets the newest intact half and the lost halves are counted");
+	struct structSpiStream* structSpiStreamLink = NULL;
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 2), 0);
+	uint32_t dmaHalf = 0;
+	uint8_t* transmit = NULL;
+	// three halves finished, the dma is back on the second half, only the third is intact
+	for (uint8_t index = 0; index < 3; index++) {
+		spiStreamDmaHalf(structSpiStreamLink, &dmaHalf);
+	}
+	uint8_t* receive = spiStreamTake(structSpiStreamLink, &transmit);
+	ASSERT_TRUE(receive == structSpiStreamLink->receivePtr);
+	ASSERT_EQ(structSpiStreamLink->overrunCount, 2);
+	ASSERT_EQ(spiStreamGive(structSpiStreamLink), 0);
+	// the consumer holds a half while the dma finishes the other half and starts over the held one
+	receive = spiStreamTake(structSpiStreamLink, &transmit);
+	ASSERT_TRUE(receive == NULL);
+	spiStreamDmaHalf(structSpiStreamLink, &dmaHalf);
+	receive = spiStreamTake(structSpiStreamLink, &transmit);
+	ASSERT_TRUE(receive == structSpiStreamLink->receivePtr + structSpiStreamLink->halfSize);
+	spiStreamDmaHalf(structSpiStreamLink, &dmaHalf);
+	ASSERT_EQ(spiStreamGive(structSpiStreamLink), -1);
+	ASSERT_EQ(structSpiStreamLink->overrunCount, 3);
+	// the half finished right after the late one is still intact
+	receive = spiStreamTake(structSpiStreamLink, &transmit);
+	ASSERT_TRUE(receive == structSpiStreamLink->receivePtr);
+	ASSERT_EQ(structSpiStreamLink->overrunCount, 3);
+	ASSERT_EQ(spiStreamGive(structSpiStreamLink), 0);
+	ASSERT_EQ(spiStreamRemove(&structSpiStreamLink), 0);
+}
+
+TEST_F(spiStreamTest, spiStream_missed_callback) {
+	RecordProperty("description_1", "Test if a missed callback keeps the halves in step and counts the half it stood for");
+	struct structSpiStream* structSpiStreamLink = NULL;
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 1), 0);
+	uint8_t* transmit = NULL;
+	spiStreamHalfDone(structSpiStreamLink, 0);
+	ASSERT_TRUE(spiStreamTake(structSpiStreamLink, &transmit) == structSpiStreamLink->receivePtr);
+	ASSERT_EQ(spiStreamGive(structSpiStreamLink), 0);
+	// the transfer complete callback of the second half went missing
+	spiStreamHalfDone(structSpiStreamLink, 0);
+	ASSERT_TRUE(spiStreamTake(structSpiStreamLink, &transmit) == structSpiStreamLink->receivePtr);
+	ASSERT_TRUE(transmit == structSpiStreamLink->transmitPtr);
+	ASSERT_EQ(structSpiStreamLink->overrunCount, 1);
+	ASSERT_EQ(spiStreamGive(structSpiStreamLink), 0);
+	ASSERT_EQ(spiStreamRemove(&structSpiStreamLink), 0);
+}
+
+// SPIFORMAT ----------------------------------------------------------------------------------------------------------------
+
+class spiFormatTest : public ::testing::Test {
+  protected:
+	spiFormatTest() {
+		errorReset();
+	}
+	~spiFormatTest() {
+		spiFormatSet(SQ_FORMAT_V1);
+	}
+};
+
+TEST_F(spiFormatTest, spiFormatSet) {
+	RecordProperty("description_1", "Test if unknown versions are rejected and leave the active format as it is");
+	ASSERT_EQ(spiFormatActive->version, SQ_FORMAT_V1);
+	ASSERT_EQ(spiFormatSet(0), -1);
+	ASSERT_EQ(errorVal, ec_sq_format_bad);
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_LATEST + 1), -1);
+	ASSERT_EQ(spiFormatActive->version, SQ_FORMAT_V1);
+	errorReset();
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V2), 0);
+	ASSERT_EQ(spiFormatActive->packetSize, SQ_V2_PACKET_SIZE);
+	ASSERT_EQ(spiFormatActive->frameSize % sizeof(uint32_t), 0);
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V1), 0);
+	ASSERT_EQ(spiFormatActive->packetSize, SQ_PACKET_SIZE);
+}
+
+TEST_F(spiFormatTest, spiFormat_v2_layout) {
+	RecordProperty("description_1", "Test if v2 frames carry every field naturally aligned with the crc over three whole words");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 4), 0);
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V2), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_FRAC64, 1.5), 0);
+	// a v1 sized array no longer fits
+	uint8_t raw[SQ_PACKET_SIZE] = {ID_TEST_UINT8};
+	ASSERT_EQ(spiQueuePostArray(structSpiQueueTransmit, raw, SQ_PACKET_SIZE, false), -1);
 	ASSERT_EQ(errorVal, ec_sq_incorrect_array_length);
+	alignas(uint32_t) uint8_t frame[SQ_V2_PACKET_SIZE];
+	memset(frame, 0xFF, sizeof(frame));
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frame, 1), 1);
+	ASSERT_EQ(frame[SQ_ID_INDEX], ID_TEST_FRAC64);
+	ASSERT_EQ(spiFrameGetPayload(frame).frac64, 1.5);
+	double payload;
+	memcpy(&payload, frame + SQ_V2_PAYLOAD_INDEX, sizeof(payload));
+	ASSERT_EQ(payload, 1.5);
+	ASSERT_EQ(spiFrameGetCrc(frame), (uint16_t)crcCalcFast(&crcXmodem16, frame, SQ_V2_FRAME_SIZE));
+	ASSERT_TRUE(spiFrameCrcGood(frame));
+	ASSERT_EQ(frame[SQ_V2_PACKET_SIZE - 2], 0x00);
+	ASSERT_EQ(frame[SQ_V2_PACKET_SIZE - 1], 0x00);
+	// the sequence byte survives a round trip through the spiqueue
+	frame[SQ_V2_SEQUENCE_INDEX] = 0x5A;
+	union unionCrc crc;
+	crc.uint16 = GETCRC(frame);
+	memcpy(frame + SQ_V2_CRC_INDEX, crc.uint8, SQ_CRC_SIZE);
+	ASSERT_EQ(spiQueuePostArray(structSpiQueueTransmit, frame, SQ_V2_PACKET_SIZE, true), 0);
+	ASSERT_TRUE(structSpiQueueTransmit->tailPacketPtr->crc.good);
+	alignas(uint32_t) uint8_t frameGet[SQ_V2_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frameGet, 1), 1);
+	ASSERT_EQ(spiFrameGetSequence(frameGet), 0x5A);
+	ASSERT_EQ(memcmp(frame, frameGet, SQ_V2_PACKET_SIZE), 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiFormatTest, spiFormat_v2_stream) {
+	RecordProperty("description_1", "Test if a stream created in v2 strides over whole words and pads with v2 filler frames");
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V2), 0);
+	struct structSpiStream* structSpiStreamLink = NULL;
+	ASSERT_EQ(spiStreamCreate(&structSpiStreamLink, 3), 0);
+	ASSERT_EQ(structSpiStreamLink->halfSize, 3 * SQ_V2_PACKET_SIZE);
+	for (uint8_t index = 0; index < 6; index++) {
+		uint8_t* frame = structSpiStreamLink->transmitPtr + index * SQ_V2_PACKET_SIZE;
+		ASSERT_EQ((uintptr_t)frame % sizeof(uint32_t), 0);
+		ASSERT_EQ(spiFrameGetId(frame), ID_FILLER);
+		ASSERT_TRUE(spiFrameCrcGood(frame));
+	}
+	ASSERT_EQ(spiStreamRemove(&structSpiStreamLink), 0);
+}
+
+TEST_F(spiFormatTest, spiFormat_negotiate) {
+	RecordProperty("description_1", "Test if both sides of a link agree on the highest version they have in common");
+	RecordProperty("description_2", "Test if a side only takes the agreed version once the other side sent it back");
+	RecordProperty("description_3", "Test if a corrupted offer is ignored and keeps the other side waiting");
+	uint8_t offerNew[SQ_PACKET_SIZE];
+	uint8_t offerOld[SQ_PACKET_SIZE];
+	uint8_t agreedNew = 0;
+	uint8_t agreedOld = 0;
+	// first transaction, a v2 side meeting a v1 side, each answering the offer of the other
+	spiFormatOffer(offerNew, SQ_FORMAT_V2, agreedNew);
+	spiFormatOffer(offerOld, SQ_FORMAT_V1, agreedOld);
+	ASSERT_EQ(spiFrameGetId(offerNew), ID_FORMAT);
+	ASSERT_TRUE(spiFrameCrcGood(offerNew));
+	ASSERT_EQ(spiFormatAnswer(offerOld, SQ_FORMAT_V2, &agreedNew), 0);
+	ASSERT_EQ(spiFormatAnswer(offerNew, SQ_FORMAT_V1, &agreedOld), 0);
+	ASSERT_EQ(agreedNew, SQ_FORMAT_V1);
+	ASSERT_EQ(agreedOld, SQ_FORMAT_V1);
+	// second transaction, both offers carry the agreed version back
+	spiFormatOffer(offerNew, SQ_FORMAT_V2, agreedNew);
+	spiFormatOffer(offerOld, SQ_FORMAT_V1, agreedOld);
+	ASSERT_EQ(spiFormatAnswer(offerOld, SQ_FORMAT_V2, &agreedNew), SQ_FORMAT_V1);
+	ASSERT_EQ(spiFormatAnswer(offerNew, SQ_FORMAT_V1, &agreedOld), SQ_FORMAT_V1);
+	// two v2 sides, the second offer of one side gets corrupted on the way
+	uint8_t offerOther[SQ_PACKET_SIZE];
+	uint8_t agreedOther = 0;
+	agreedNew = 0;
+	spiFormatOffer(offerNew, SQ_FORMAT_V2, agreedNew);
+	spiFormatOffer(offerOther, SQ_FORMAT_V2, agreedOther);
+	ASSERT_EQ(spiFormatAnswer(offerOther, SQ_FORMAT_V2, &agreedNew), 0);
+	ASSERT_EQ(spiFormatAnswer(offerNew, SQ_FORMAT_V2, &agreedOther), 0);
+	spiFormatOffer(offerNew, SQ_FORMAT_V2, agreedNew);
+	spiFormatOffer(offerOther, SQ_FORMAT_V2, agreedOther);
+	offerNew[SQ_PAYLOAD_INDEX + 2] ^= 0x01;
+	ASSERT_EQ(spiFormatAnswer(offerOther, SQ_FORMAT_V2, &agreedNew), SQ_FORMAT_V2);
+	ASSERT_EQ(spiFormatAnswer(offerNew, SQ_FORMAT_V2, &agreedOther), -1);
+	ASSERT_EQ(spiFormatActive->version, SQ_FORMAT_V1);
+	// anything but an intact offer is skipped
+	uint8_t filler[SQ_PACKET_SIZE] = {ID_FILLER};
+	ASSERT_EQ(spiFormatAnswer(filler, SQ_FORMAT_V2, &agreedOther), -1);
+	uint8_t offerNone[SQ_PACKET_SIZE];
+	spiFormatOffer(offerNone, 0, 0);
+	ASSERT_EQ(spiFormatAnswer(offerNone, SQ_FORMAT_V2, &agreedOther), -1);
+	ASSERT_EQ(errorVal, ec_sq_format_bad);
+	ASSERT_EQ(agreedOther, SQ_FORMAT_V2);
+}
+
+// SPIRECORD ----------------------------------------------------------------------------------------------------------------
+
+class spiRecordTest : public ::testing::Test {
+  protected:
+	spiRecordTest() {
+		errorReset();
+	}
+	~spiRecordTest() {
+		spiFormatSet(SQ_FORMAT_V1);
+	}
+};
+
+TEST_F(spiRecordTest, spiRecord_layout) {
+	RecordProperty("description_1", "Test if a record takes whole packet slots with its fields word aligned and the crc on a word boundary");
+	ASSERT_EQ(spiRecordSlots(ID_TEST_UINT8), 0);
+	ASSERT_EQ(spiRecordSlots(ID_RECORD_SETPOINTS), 3);
+	ASSERT_EQ(spiRecordSlots(ID_RECORD_PLANT), 4);
+	const double setpoints[] = {1.5, -2.5, 300.0, 400.25};
+	alignas(uint32_t) uint8_t record[SQ_RECORD_SIZE_MAX];
+	memset(record, 0xFF, sizeof(record));
+	ASSERT_EQ(spiRecordEncode(record, ID_RECORD_SETPOINTS, setpoints), 3 * SQ_PACKET_SIZE);
+	ASSERT_EQ(spiFrameGetId(record), ID_RECORD_SETPOINTS);
+	ASSERT_EQ(record[SQ_RECORD_VERSION_INDEX], 1);
+	for (uint8_t field = 0; field < arraysize(setpoints); field++) {
+		double payload;
+		memcpy(&payload, record + SQ_RECORD_PAYLOAD_INDEX + field * sizeof(double), sizeof(payload));
+		ASSERT_EQ(payload, setpoints[field]);
+	}
+	union unionCrc crc;
+	memcpy(crc.uint8, record + 36, SQ_CRC_SIZE);
+	ASSERT_EQ(crc.uint16, (uint16_t)crcCalcFast(&crcXmodem16, record, 36));
+	ASSERT_EQ(record[3 * SQ_PACKET_SIZE - 1], 0x00);
+	// the same records in v2 take as many slots, which are larger
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V2), 0);
+	ASSERT_EQ(spiRecordSlots(ID_RECORD_SETPOINTS), 3);
+	ASSERT_EQ(spiRecordSlots(ID_RECORD_PLANT), 4);
+	ASSERT_EQ(spiRecordEncode(record, ID_RECORD_SETPOINTS, setpoints), 3 * SQ_V2_PACKET_SIZE);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiRecordTest, spiRecord_roundtrip) {
+	RecordProperty("description_1", "Test if every field of a record decodes to the value it was encoded with, in both formats");
+	RecordProperty("description_2", "Test if records of another version, with a bad crc or a field out of range are rejected whole");
+	const double plant[] = {-120.5, 250.75, 0.5f, 0.25f, 1500, 2500, 210.5f, 198.25f, 3};
+	for (uint8_t version = SQ_FORMAT_V1; version <= SQ_FORMAT_LATEST; version++) {
+		ASSERT_EQ(spiFormatSet(version), 0);
+		alignas(uint32_t) uint8_t record[SQ_RECORD_SIZE_MAX];
+		ASSERT_EQ(spiRecordEncode(record, ID_RECORD_PLANT, plant), 4 * spiFormatActive->packetSize);
+		uint8_t ids[SQ_RECORD_FIELDS_MAX];
+		union unionPayload values[SQ_RECORD_FIELDS_MAX];
+		ASSERT_EQ(spiRecordDecode(record, ids, values), 9);
+		ASSERT_EQ(ids[0], ID_POWER_BATTERY_1);
+		ASSERT_EQ(values[0].frac64, plant[0]);
+		ASSERT_EQ(values[1].frac64, plant[1]);
+		ASSERT_EQ(ids[2], ID_SOC_BATTERY_1);
+		ASSERT_EQ(values[2].frac32, (float)plant[2]);
+		ASSERT_EQ(values[3].frac32, (float)plant[3]);
+		ASSERT_EQ(ids[4], ID_POWER_DG_1);
+		ASSERT_EQ(values[4].uint32, 1500);
+		ASSERT_EQ(values[5].uint32, 2500);
+		ASSERT_EQ(values[6].frac32, (float)plant[6]);
+		ASSERT_EQ(values[7].frac32, (float)plant[7]);
+		ASSERT_EQ(ids[8], ID_OPSTATE);
+		ASSERT_EQ(values[8].uint8[0], 3);
+		ASSERT_EQ(values[8].uint8[1], 0);
+		// a single flipped bit or another layout version drops the whole record
+		record[SQ_RECORD_PAYLOAD_INDEX + 20] ^= 0x04;
+		ASSERT_EQ(spiRecordDecode(record, ids, values), -1);
+		record[SQ_RECORD_PAYLOAD_INDEX + 20] ^= 0x04;
+		record[SQ_RECORD_VERSION_INDEX] = 2;
+		ASSERT_EQ(spiRecordDecode(record, ids, values), -1);
+	}
+	alignas(uint32_t) uint8_t record[SQ_RECORD_SIZE_MAX];
+	double plantBad[arraysize(plant)];
+	memcpy(plantBad, plant, sizeof(plant));
+	plantBad[8] = 300;
+	ASSERT_EQ(spiRecordEncode(record, ID_RECORD_PLANT, plantBad), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_uint8);
+	ASSERT_EQ(spiRecordEncode(record, ID_TEST_FRAC64, plant), -1);
+	ASSERT_EQ(errorVal, ec_sq_bad_id);
+	uint8_t frame[SQ_PACKET_SIZE] = {ID_TEST_FRAC64};
+	uint8_t ids[SQ_RECORD_FIELDS_MAX];
+	union unionPayload values[SQ_RECORD_FIELDS_MAX];
+	ASSERT_EQ(spiRecordDecode(frame, ids, values), -1);
+}
+
+TEST_F(spiRecordTest, spiRecord_box) {
+	RecordProperty("description_1", "Test if the spirecordbox keeps the newest record per id and hands out whole records only");
+	RecordProperty("description_2", "Test if the first record in an empty spirecordbox wakes the consumer");
+	struct structSpiRecordBox box = {};
+	const double setpoints[] = {1, 2, 3, 4};
+	const double setpointsNew[] = {5, 6, 7, 8};
+	const double plant[] = {1, 2, 3, 4, 5, 6, 7, 8, 1};
+	ASSERT_EQ(spiRecordPost(NULL, ID_RECORD_SETPOINTS, setpoints), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist_post);
+	errorReset();
+	box.consumerTaskPtr = (void*)2;
+	spiQueueNotifyHook = spiQueueNotifyCount;
+	spiQueueNotifyCalls = 0;
+	ASSERT_EQ(spiRecordPost(&box, ID_RECORD_SETPOINTS, setpoints), 0);
+	ASSERT_EQ(spiRecordPost(&box, ID_RECORD_SETPOINTS, setpointsNew), 0);
+	ASSERT_EQ(spiRecordPost(&box, ID_RECORD_PLANT, plant), 0);
+	ASSERT_EQ(spiQueueNotifyCalls, 1);
+	spiQueueNotifyHook = NULL;
+	ASSERT_EQ(box.pendingCount, 2);
+	ASSERT_EQ(box.overwriteCount, 1);
+	// a failed post leaves the waiting record as it is
+	const double setpointsBad[] = {1, 2, 3};
+	ASSERT_EQ(spiRecordPost(&box, ID_TEST_UINT8, setpointsBad), -1);
+	ASSERT_EQ(box.pendingCount, 2);
+	errorReset();
+	// the plant record does not fit behind the setpoints and waits for the next transfer
+	alignas(uint32_t) uint8_t burst[8 * SQ_PACKET_SIZE];
+	ASSERT_EQ(spiRecordGet(&box, burst, 5), 3);
+	uint8_t ids[SQ_RECORD_FIELDS_MAX];
+	union unionPayload values[SQ_RECORD_FIELDS_MAX];
+	ASSERT_EQ(spiRecordDecode(burst, ids, values), 4);
+	ASSERT_EQ(values[0].frac64, 5);
+	ASSERT_EQ(values[3].frac64, 8);
+	ASSERT_EQ(spiRecordGet(&box, burst, 3), 0);
+	ASSERT_EQ(spiRecordGet(&box, burst, 8), 4);
+	ASSERT_EQ(spiRecordDecode(burst, ids, values), 9);
+	ASSERT_EQ(box.pendingCount, 0);
+	ASSERT_EQ(spiRecordGet(&box, burst, 8), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+// SPIFIXED -----------------------------------------------------------------------------------------------------------------
+
+class spiFixedTest : public ::testing::Test {
+  protected:
+	spiFixedTest() {
+		errorReset();
+	}
+	~spiFixedTest() {
+		spiFormatSet(SQ_FORMAT_V1);
+	}
+};
+
+TEST_F(spiFixedTest, spiFixed_codec) {
+	RecordProperty("description_1", "Test if multiples of the scale survive a round trip exactly up to the int32 edges");
+	RecordProperty("description_2", "Test if any other value comes back within half a scale step, rounded half away from zero");
+	int32_t count = 0;
+	for (int64_t step = -100000; step <= 100000; step += 997) {
+		ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, step * 100, &count), 0);
+		ASSERT_EQ(count, step);
+		ASSERT_EQ(spiFixedDecode(ID_SETPOINT_BATTERY_1, count), step * 100);
+	}
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, (int64_t)INT32_MAX * 100 + 49, &count), 0);
+	ASSERT_EQ(count, INT32_MAX);
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, (int64_t)INT32_MIN * 100 - 49, &count), 0);
+	ASSERT_EQ(count, INT32_MIN);
+	ASSERT_EQ(spiFixedDecode(ID_SETPOINT_BATTERY_1, INT32_MIN), (int64_t)INT32_MIN * 100);
+	for (int64_t milli = -100000; milli <= 100000; milli += 7) {
+		ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, milli, &count), 0);
+		int64_t error = spiFixedDecode(ID_SETPOINT_BATTERY_1, count) - milli;
+		ASSERT_LE(error, 50);
+		ASSERT_GE(error, -50);
+	}
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, 50, &count), 0);
+	ASSERT_EQ(count, 1);
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, -50, &count), 0);
+	ASSERT_EQ(count, -1);
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, 49, &count), 0);
+	ASSERT_EQ(count, 0);
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, -49, &count), 0);
+	ASSERT_EQ(count, 0);
+	// the offset moves count zero, the scale of a row with an offset does not have to be even
+	ASSERT_EQ(spiFixedEncode(ID_TEST_FRAC32, -40000, &count), 0);
+	ASSERT_EQ(count, 0);
+	ASSERT_EQ(spiFixedEncode(ID_TEST_FRAC32, -39988, &count), 0);
+	ASSERT_EQ(count, 0);
+	ASSERT_EQ(spiFixedEncode(ID_TEST_FRAC32, -39987, &count), 0);
+	ASSERT_EQ(count, 1);
+	ASSERT_EQ(spiFixedEncode(ID_TEST_FRAC32, 0, &count), 0);
+	ASSERT_EQ(count, 1600);
+	ASSERT_EQ(spiFixedDecode(ID_TEST_FRAC32, -4), -40100);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiFixedTest, spiFixed_out_of_range) {
+	RecordProperty("description_1", "Test if values beyond an int32 count and ids without a lexicon row are rejected");
+	int32_t count = 12;
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, (int64_t)INT32_MAX * 100 + 50, &count), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_fixed);
+	ASSERT_EQ(count, 12);
+	errorReset();
+	ASSERT_EQ(spiFixedEncode(ID_SETPOINT_BATTERY_1, (int64_t)INT32_MIN * 100 - 50, &count), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_fixed);
+	errorReset();
+	ASSERT_EQ(spiFixedEncode(ID_TEST_UINT8, INT64_MAX, &count), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_fixed);
+	errorReset();
+	ASSERT_EQ(spiFixedEncode(ID_TEST_UINT8, INT64_MIN, &count), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_fixed);
+	errorReset();
+	ASSERT_EQ(spiFixedEncode(ID_BAD_LOW, 0, &count), -1);
+	ASSERT_EQ(errorVal, ec_sq_bad_id);
+	ASSERT_EQ(count, 12);
+}
+
+TEST_F(spiFixedTest, spiFixed_pair) {
+	RecordProperty("description_1", "Test if a pair frame carries two setpoints within half a scale step of the double reference in v1 and v2");
+	RecordProperty("description_2", "Test if a pair with a half out of range leaves the spiqueue untouched");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 4), 0);
+	const double reference[][2] = {{0.0, -0.0}, {123.456, -123.456}, {0.049, -0.051}, {2999.95, -1500.05}, {40000.0, 0.1}};
+	const uint8_t versions[] = {SQ_FORMAT_V1, SQ_FORMAT_V2};
+	for (uint8_t version = 0; version < arraysize(versions); version++) {
+		ASSERT_EQ(spiFormatSet(versions[version]), 0);
+		for (uint8_t row = 0; row < arraysize(reference); row++) {
+			ASSERT_EQ(spiFixedPost(structSpiQueueTransmit, ID_SETPOINT_BATTERIES, llround(reference[row][0] * 1000), llround(reference[row][1] * 1000)), 0);
+			alignas(uint32_t) uint8_t frame[SQ_SLOT_SIZE] = {0};
+			ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frame, 1), 1);
+			ASSERT_EQ(spiFrameGetId(frame), ID_SETPOINT_BATTERIES);
+			ASSERT_TRUE(spiFrameCrcGood(frame));
+			uint8_t ids[2];
+			int64_t values[2];
+			ASSERT_EQ(spiFixedGet(frame, ids, values), 0);
+			ASSERT_EQ(ids[0], ID_SETPOINT_BATTERY_1);
+			ASSERT_EQ(ids[1], ID_SETPOINT_BATTERY_2);
+			ASSERT_NEAR(values[0] / 1000.0, reference[row][0], 0.05 + 1e-9);
+			ASSERT_NEAR(values[1] / 1000.0, reference[row][1], 0.05 + 1e-9);
+		}
+	}
+	// both halves are checked before anything is posted
+	ASSERT_EQ(spiFixedPost(structSpiQueueTransmit, ID_SETPOINT_BATTERIES, 0, (int64_t)INT32_MAX * 1000), -1);
+	ASSERT_EQ(errorVal, ec_sq_payload_out_of_range_fixed);
+	ASSERT_EQ(structSpiQueueTransmit->sizeCurrent, 0);
+	ASSERT_EQ(structSpiQueueTransmit->metrics.drops[SQ_DROP_ENCODE], 1);
+	errorReset();
+	ASSERT_EQ(spiFixedPost(structSpiQueueTransmit, ID_SETPOINT_BATTERY_1, 0, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_bad_id);
+	ASSERT_EQ(structSpiQueueTransmit->metrics.drops[SQ_DROP_ENCODE], 2);
+	errorReset();
+	// the halves of the test pair have their own scale and offset
+	ASSERT_EQ(spiFixedPost(structSpiQueueTransmit, ID_TEST_FIXED, -40100, 7), 0);
+	alignas(uint32_t) uint8_t frame[SQ_SLOT_SIZE] = {0};
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frame, 1), 1);
+	ASSERT_EQ(spiFrameGetPayload(frame).sint32, -4);
+	uint8_t ids[2];
+	int64_t values[2];
+	ASSERT_EQ(spiFixedGet(frame, ids, values), 0);
+	ASSERT_EQ(values[0], -40100);
+	ASSERT_EQ(values[1], 7);
+	// frames of another datatype are no pairs
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_FRAC64, 1.5), 0);
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frame, 1), 1);
+	ASSERT_EQ(spiFixedGet(frame, ids, values), -1);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+// SPIWINDOW ----------------------------------------------------------------------------------------------------------------
+
+class spiWindowTest : public ::testing::Test {
+  protected:
+	spiWindowTest() {
+		errorReset();
+	}
+	~spiWindowTest() {
+		spiFormatSet(SQ_FORMAT_V1);
+	}
+};
+
+/** @brief one end of a simulated link */
+struct spiWindowTestEnd {
+	struct structSpiQueue* queue;	/**< frames posted by this end */
+	struct structSpiWindow* window; /**< frames of this end awaiting an ack */
+	struct structSpiLink link;		/**< sequences stamped and received by this end */
+	uint32_t received[256];			/**< newest payload received per id */
+	uint8_t peak;					/**< most entries awaiting an ack at once */
+};
+
+/**
+ * @brief encodes a transaction the way the spi task does, resent frames first
+ * @param[in] endArg sending end
+ * @param[out] arrayArg room for maxslotsarg packet slots
+ * @param[in] maxSlotsArg packet slots of the transaction
+ * @param[in] tickArg current tick
+ * @retval packet slots filled
+ */
+static int16_t spiWindowTestEncode(struct spiWindowTestEnd* endArg, uint8_t arrayArg[], uint8_t maxSlotsArg, uint32_t tickArg) {
+	int16_t resent = spiWindowResend(endArg->window, arrayArg, maxSlotsArg, tickArg);
+	int16_t queued = spiQueueGetBurst(endArg->queue, arrayArg + resent * spiFormatActive->packetSize, maxSlotsArg - resent);
+	spiLinkStamp(&endArg->link, arrayArg + resent * spiFormatActive->packetSize, queued);
+	int16_t slots = resent + spiWindowSend(endArg->window, arrayArg + resent * spiFormatActive->packetSize, queued, maxSlotsArg - resent, tickArg);
+	endArg->peak = endArg->window->count > endArg->peak ? endArg->window->count : endArg->peak;
+	return slots;
+}
+
+/**
+ * @brief decodes a transaction the way the spi task does
+ * @param[in] endArg receiving end
+ * @param[in] arrayArg frames of the transaction, empty slots are zero
+ * @param[in] slotsArg packet slots of the transaction
+ */
+static void spiWindowTestDecode(struct spiWindowTestEnd* endArg, uint8_t arrayArg[], int16_t slotsArg) {
+	for (int16_t index = 0; index < slotsArg; index++) {
+		uint8_t* frame = arrayArg + index * spiFormatActive->packetSize;
+		if (spiFrameGetId(frame) == 0x00) {
+			continue;
+		}
+		int8_t verdict = spiLinkReceive(&endArg->link, frame);
+		if (verdict == SQ_LINK_CRC_FAILED) {
+			continue;
+		}
+		spiWindowReceive(endArg->window, frame);
+		if (verdict == SQ_LINK_DUPLICATE) {
+			continue;
+		}
+		endArg->received[spiFrameGetId(frame)] = spiFrameGetPayload(frame).uint32;
+	}
+}
+
+/**
+ * @brief corrupts about one in lossarg frames of a transaction
+ * @param[in,out] arrayArg frames of the transaction
+ * @param[in] slotsArg packet slots of the transaction
+ * @param[in,out] seedArg state of the pseudo random generator
+ * @param[in] lossArg inverse of the loss rate
+ */
+static void spiWindowTestLose(uint8_t arrayArg[], int16_t slotsArg, uint32_t* seedArg, uint32_t lossArg) {
+	for (int16_t index = 0; index < slotsArg; index++) {
+		*seedArg = *seedArg * 1103515245 + 12345;
+		if ((*seedArg >> 16) % lossArg == 0) {
+			arrayArg[index * spiFormatActive->packetSize + spiFormatActive->payloadIndex] ^= 0x5A;
+		}
+	}
+}
+
+TEST_F(spiWindowTest, spiWindowCreate) {
+	RecordProperty("description_1", "Test creation and removal of a spiwindow with bad and good bounds");
+	struct structSpiWindow* structSpiWindowLink = NULL;
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowLink, 0, 3), -1);
+	ASSERT_EQ(errorVal, ec_sq_window_bad);
+	errorReset();
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowLink, 3, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_window_bad);
+	errorReset();
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowLink, 3, 2), 0);
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowLink, 3, 2), -1);
+	ASSERT_EQ(errorVal, ec_sq_already_exist);
+	errorReset();
+	ASSERT_EQ(structSpiWindowLink->count, 0);
+	ASSERT_EQ(structSpiWindowLink->timeout, 3);
+	uint8_t array[SQ_PACKET_SIZE];
+	ASSERT_EQ(spiWindowSend(NULL, array, 0, 1, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	errorReset();
+	ASSERT_EQ(spiWindowResend(NULL, array, 1, 0), -1);
+	ASSERT_EQ(spiWindowReceive(NULL, array), -1);
+	errorReset();
+	ASSERT_EQ(spiWindowRemove(&structSpiWindowLink), 0);
+	ASSERT_EQ(spiWindowRemove(&structSpiWindowLink), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+}
+
+TEST_F(spiWindowTest, spiWindow_ack) {
+	RecordProperty("description_1", "Test if a sent frame stays until its crc comes back in an ack field and is resent unchanged after the timeout");
+	RecordProperty("description_2", "Test if acks ride in new frames or fillers and fillers themselves are neither kept nor acked");
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	struct structSpiWindow* structSpiWindowMaster = NULL;
+	struct structSpiWindow* structSpiWindowSlave = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 10), 0);
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowMaster, 3, 2), 0);
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowSlave, 3, 2), 0);
+	uint8_t sent[4 * SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 5), 0);
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, sent, 4), 1);
+	ASSERT_EQ(spiWindowSend(structSpiWindowMaster, sent, 1, 4, 10), 1);
+	ASSERT_EQ(structSpiWindowMaster->count, 1);
+	ASSERT_EQ(spiFrameGetAck(sent), 0);
+	// nothing is resent before the timeout, then the frame comes again byte for byte
+	uint8_t resent[4 * SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiWindowResend(structSpiWindowMaster, resent, 4, 12), 0);
+	ASSERT_EQ(spiWindowResend(structSpiWindowMaster, resent, 4, 13), 1);
+	ASSERT_EQ(memcmp(resent, sent, SQ_PACKET_SIZE), 0);
+	ASSERT_EQ(structSpiWindowMaster->metrics.resent, 1);
+	// the slave has nothing to send, its ack goes out in a filler
+	ASSERT_EQ(spiWindowReceive(structSpiWindowSlave, sent), 0);
+	ASSERT_EQ(spiWindowReceive(structSpiWindowSlave, resent), 0);
+	ASSERT_EQ(structSpiWindowSlave->ackCount, 1);
+	uint8_t answer[4 * SQ_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiWindowSend(structSpiWindowSlave, answer, 0, 4, 13), 1);
+	ASSERT_EQ(spiFrameGetId(answer), ID_FILLER);
+	ASSERT_EQ(spiFrameGetAck(answer), spiFrameGetCrc(sent));
+	ASSERT_TRUE(spiFrameCrcGood(answer));
+	ASSERT_EQ(structSpiWindowSlave->count, 0);
+	ASSERT_EQ(spiWindowReceive(structSpiWindowMaster, answer), 0);
+	ASSERT_EQ(structSpiWindowMaster->count, 0);
+	ASSERT_EQ(structSpiWindowMaster->ackCount, 0);
+	ASSERT_EQ(structSpiWindowMaster->metrics.acked, 1);
+	// an ack in a new frame changes its crc, the window keeps the crc that went out
+	ASSERT_EQ(spiWindowReceive(structSpiWindowSlave, sent), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT16, 7), 0);
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, answer, 4), 1);
+	ASSERT_EQ(spiWindowSend(structSpiWindowSlave, answer, 1, 4, 14), 1);
+	ASSERT_EQ(spiFrameGetAck(answer), spiFrameGetCrc(sent));
+	ASSERT_TRUE(spiFrameCrcGood(answer));
+	ASSERT_EQ(structSpiWindowSlave->entry[0].crc, spiFrameGetCrc(answer));
+	ASSERT_EQ(structSpiWindowSlave->count, 1);
+	// an entry that went out triesmax times is given up
+	ASSERT_EQ(spiWindowResend(structSpiWindowSlave, resent, 4, 17), 1);
+	ASSERT_EQ(spiWindowResend(structSpiWindowSlave, resent, 4, 20), 0);
+	ASSERT_EQ(structSpiWindowSlave->count, 0);
+	ASSERT_EQ(structSpiWindowSlave->metrics.expired, 1);
+	// a newer frame of an id replaces the unacked one, a full window gives up its oldest entry
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT8, ID_TEST_UINT16, ID_TEST_UINT32, ID_TEST_SINT8, ID_TEST_SINT16, ID_TEST_SINT32,
+						   ID_LATENCY, ID_OPSTATE, ID_POWER_DG_1};
+	for (uint8_t index = 0; index < arraysize(ids); index++) {
+		ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ids[index], index), 0);
+		ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, sent, 1), 1);
+		ASSERT_EQ(spiWindowSend(structSpiWindowMaster, sent, 1, 1, 20 + index), 1);
+	}
+	ASSERT_EQ(structSpiWindowMaster->count, SQ_WINDOW_SIZE);
+	ASSERT_EQ(structSpiWindowMaster->metrics.superseded, 1);
+	ASSERT_EQ(structSpiWindowMaster->metrics.expired, 1);
+	for (uint8_t index = 0; index < SQ_WINDOW_SIZE; index++) {
+		ASSERT_NE(spiFrameGetId(structSpiWindowMaster->entry[index].array), ID_TEST_UINT8);
+	}
+	ASSERT_EQ(spiWindowRemove(&structSpiWindowMaster), 0);
+	ASSERT_EQ(spiWindowRemove(&structSpiWindowSlave), 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiWindowTest, spiWindow_record) {
+	RecordProperty("description_1", "Test if a record is kept whole until the crc at its end comes back");
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V2), 0);
+	struct structSpiWindow* structSpiWindowMaster = NULL;
+	struct structSpiWindow* structSpiWindowSlave = NULL;
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowMaster, 3, 4), 0);
+	ASSERT_EQ(spiWindowCreate(&structSpiWindowSlave, 3, 4), 0);
+	const double setpoints[] = {1.5, -2.5, 300.0, 400.25};
+	alignas(uint32_t) uint8_t sent[8 * SQ_V2_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiRecordEncode(sent, ID_RECORD_SETPOINTS, setpoints), 3 * SQ_V2_PACKET_SIZE);
+	ASSERT_EQ(spiWindowSend(structSpiWindowMaster, sent, 3, 8, 0), 3);
+	ASSERT_EQ(structSpiWindowMaster->entry[0].slots, 3);
+	alignas(uint32_t) uint8_t resent[8 * SQ_V2_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiWindowResend(structSpiWindowMaster, resent, 2, 3), 0);
+	ASSERT_EQ(spiWindowResend(structSpiWindowMaster, resent, 8, 3), 3);
+	ASSERT_EQ(memcmp(resent, sent, 3 * SQ_V2_PACKET_SIZE), 0);
+	ASSERT_EQ(spiWindowReceive(structSpiWindowSlave, resent), 0);
+	alignas(uint32_t) uint8_t answer[8 * SQ_V2_PACKET_SIZE] = {0};
+	ASSERT_EQ(spiWindowSend(structSpiWindowSlave, answer, 0, 8, 3), 1);
+	ASSERT_EQ(spiWindowReceive(structSpiWindowMaster, answer), 0);
+	ASSERT_EQ(structSpiWindowMaster->count, 0);
+	ASSERT_EQ(structSpiWindowMaster->metrics.acked, 1);
+	ASSERT_EQ(spiWindowRemove(&structSpiWindowMaster), 0);
+	ASSERT_EQ(spiWindowRemove(&structSpiWindowSlave), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+TEST_F(spiWindowTest, spiWindow_lossy_link) {
+	RecordProperty("description_1", "Test if both ends of a link losing one in five frames each way end up with the newest value of every id");
+	RecordProperty("description_2", "Test if frames keep going out while earlier ones await their ack instead of waiting for every ack");
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_TEST_UINT16, ID_TEST_UINT32, ID_TEST_SINT8, ID_TEST_SINT16, ID_TEST_SINT32, ID_LATENCY};
+	const uint8_t versions[] = {SQ_FORMAT_V1, SQ_FORMAT_V2};
+	for (uint8_t version = 0; version < arraysize(versions); version++) {
+		ASSERT_EQ(spiFormatSet(versions[version]), 0);
+		struct spiWindowTestEnd master = {};
+		struct spiWindowTestEnd slave = {};
+		ASSERT_EQ(spiQueueCreate(&master.queue, 64), 0);
+		ASSERT_EQ(spiQueueCreate(&slave.queue, 64), 0);
+		ASSERT_EQ(spiWindowCreate(&master.window, 3, 50), 0);
+		ASSERT_EQ(spiWindowCreate(&slave.window, 3, 50), 0);
+		uint32_t posted[2][256] = {0};
+		uint32_t seed = 1;
+		uint32_t tick = 0;
+		uint32_t transactions = 0;
+		for (; tick < 1000 || master.window->count + slave.window->count + master.window->ackCount + slave.window->ackCount > 0; tick++) {
+			ASSERT_LT(tick, 2000);
+			if (tick < 1000) {
+				uint8_t id = ids[tick % arraysize(ids)];
+				ASSERT_EQ(spiQueuePost(master.queue, id, (int32_t)(tick % 100)), 0);
+				posted[0][id] = tick % 100;
+				if (tick % 3 == 0) {
+					id = ids[(tick / 3) % arraysize(ids)];
+					ASSERT_EQ(spiQueuePost(slave.queue, id, (int32_t)(tick % 50)), 0);
+					posted[1][id] = tick % 50;
+				}
+			}
+			// both ends clock the same number of slots, the shorter side sends zeros
+			alignas(uint32_t) uint8_t masterArray[4 * SQ_SLOT_SIZE] = {0};
+			alignas(uint32_t) uint8_t slaveArray[4 * SQ_SLOT_SIZE] = {0};
+			int16_t masterSlots = spiWindowTestEncode(&master, masterArray, 4, tick);
+			int16_t slaveSlots = spiWindowTestEncode(&slave, slaveArray, 4, tick);
+			int16_t slots = masterSlots > slaveSlots ? masterSlots : slaveSlots;
+			if (slots == 0) {
+				continue;
+			}
+			spiWindowTestLose(masterArray, slots, &seed, 5);
+			spiWindowTestLose(slaveArray, slots, &seed, 5);
+			spiWindowTestDecode(&slave, masterArray, slots);
+			spiWindowTestDecode(&master, slaveArray, slots);
+			transactions++;
+		}
+		for (uint8_t index = 0; index < arraysize(ids); index++) {
+			ASSERT_EQ(slave.received[ids[index]], posted[0][ids[index]]);
+			ASSERT_EQ(master.received[ids[index]], posted[1][ids[index]]);
+		}
+		ASSERT_GT(master.window->metrics.resent, 0);
+		ASSERT_GT(slave.window->metrics.resent, 0);
+		ASSERT_EQ(master.window->metrics.expired, 0);
+		ASSERT_EQ(master.window->metrics.acksDropped, 0);
+		ASSERT_GT(master.peak, 1);
+		ASSERT_GT(slave.link.metrics.crcFailed, 0);
+		if (versions[version] == SQ_FORMAT_V2) {
+			// frames whose ack got lost come twice, frames lost the first time come late
+			ASSERT_GT(slave.link.metrics.duplicated, 0);
+			ASSERT_GT(slave.link.metrics.outOfOrder, 0);
+		}
+		// the link drains within a few timeouts of the last post
+		ASSERT_LT(tick, 1000 + 10 * 3);
+		ASSERT_LE(transactions, tick);
+		ASSERT_EQ(spiWindowRemove(&master.window), 0);
+		ASSERT_EQ(spiWindowRemove(&slave.window), 0);
+		ASSERT_EQ(spiQueueRemove(&master.queue), 0);
+		ASSERT_EQ(spiQueueRemove(&slave.queue), 0);
+	}
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+// SPILINK ------------------------------------------------------------------------------------------------------------------
+
+class spiLinkTest : public ::testing::Test {
+  protected:
+	spiLinkTest() {
+		errorReset();
+		spiFormatSet(SQ_FORMAT_V2);
+	}
+	~spiLinkTest() {
+		spiFormatSet(SQ_FORMAT_V1);
+	}
+};
+
+/**
+ * @brief encodes a frame and stamps the next sequence of a link into it
+ * @param[in] linkArg sending link
+ * @param[out] frameArg room for one frame
+ * @param[in] identifierArg id of the frame
+ * @param[in] payloadArg payload of the frame
+ */
+static void spiLinkTestFrame(struct structSpiLink* linkArg, uint8_t frameArg[], uint8_t identifierArg, int64_t payloadArg) {
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 1), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, identifierArg, payloadArg), 0);
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frameArg, 1), 1);
+	ASSERT_EQ(spiLinkStamp(linkArg, frameArg, 1), 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+}
+
+TEST_F(spiLinkTest, spiLink_sequence) {
+	RecordProperty("description_1", "Test if a repeating value is delivered every time while a repeated sequence is dropped");
+	RecordProperty("description_2", "Test if a skipped sequence counts as lost until it comes late and counts as out of order");
+	struct structSpiLink master = {};
+	struct structSpiLink slave = {};
+	alignas(uint32_t) uint8_t frames[6][SQ_SLOT_SIZE];
+	for (uint8_t index = 0; index < 6; index++) {
+		spiLinkTestFrame(&master, frames[index], ID_TEST_UINT8, 42);
+		ASSERT_EQ(spiFrameGetSequence(frames[index]), index);
+		ASSERT_TRUE(spiFrameCrcGood(frames[index]));
+	}
+	// the same value six times is six frames
+	ASSERT_EQ(spiLinkReceive(&slave, frames[0]), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[1]), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[1]), SQ_LINK_DUPLICATE);
+	// 2 and 3 go missing, 3 shows up late and 2 twice as late
+	ASSERT_EQ(spiLinkReceive(&slave, frames[4]), SQ_LINK_NEW);
+	ASSERT_EQ(slave.metrics.lost, 2);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[3]), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[3]), SQ_LINK_DUPLICATE);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[5]), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[2]), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, frames[0]), SQ_LINK_DUPLICATE);
+	ASSERT_EQ(slave.metrics.received, 9);
+	ASSERT_EQ(slave.metrics.lost, 0);
+	ASSERT_EQ(slave.metrics.outOfOrder, 2);
+	ASSERT_EQ(slave.metrics.duplicated, 3);
+	// a corrupted frame is only counted as such
+	frames[5][spiFormatActive->payloadIndex] ^= 0x01;
+	ASSERT_EQ(spiLinkReceive(&slave, frames[5]), SQ_LINK_CRC_FAILED);
+	ASSERT_EQ(slave.metrics.crcFailed, 1);
+	ASSERT_EQ(slave.metrics.received, 9);
+	ASSERT_EQ(spiLinkStamp(NULL, frames[0], 1), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+	errorReset();
+	ASSERT_EQ(spiLinkReceive(NULL, frames[0]), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+}
+
+TEST_F(spiLinkTest, spiLink_wrap) {
+	RecordProperty("description_1", "Test if the sequence wraps without loss and a gap across the history counts every skipped sequence");
+	struct structSpiLink master = {};
+	struct structSpiLink slave = {};
+	alignas(uint32_t) uint8_t frame[SQ_SLOT_SIZE];
+	for (uint16_t index = 0; index < 600; index++) {
+		spiLinkTestFrame(&master, frame, ID_TEST_UINT16, index);
+		ASSERT_EQ(spiLinkReceive(&slave, frame), SQ_LINK_NEW);
+	}
+	ASSERT_EQ(slave.metrics.lost, 0);
+	alignas(uint32_t) uint8_t old[SQ_SLOT_SIZE];
+	memcpy(old, frame, sizeof(frame));
+	for (uint8_t index = 0; index < 100; index++) {
+		spiLinkTestFrame(&master, frame, ID_TEST_UINT16, index);
+	}
+	ASSERT_EQ(spiLinkReceive(&slave, frame), SQ_LINK_NEW);
+	ASSERT_EQ(slave.metrics.lost, 99);
+	// the last frame before the gap is still in the history
+	ASSERT_EQ(spiLinkReceive(&slave, old), SQ_LINK_DUPLICATE);
+	ASSERT_EQ(slave.metrics.outOfOrder, 0);
+}
+
+TEST_F(spiLinkTest, spiLink_record_filler_v1) {
+	RecordProperty("description_1", "Test if records take a sequence of the same link and fillers take none");
+	RecordProperty("description_2", "Test if formats without a sequence byte only count received and corrupted frames");
+	struct structSpiLink master = {};
+	struct structSpiLink slave = {};
+	struct structSpiRecordBox box = {};
+	const double setpoints[] = {1, 2, 3, 4};
+	alignas(uint32_t) uint8_t burst[8 * SQ_SLOT_SIZE];
+	ASSERT_EQ(spiRecordPost(&box, ID_RECORD_SETPOINTS, setpoints), 0);
+	int16_t slots = spiRecordGet(&box, burst, 8);
+	ASSERT_GT(slots, 1);
+	struct structSpiQueue* structSpiQueueTransmit = NULL;
+	ASSERT_EQ(spiQueueCreate(&structSpiQueueTransmit, 4), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_FILLER, 0), 0);
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 7), 0);
+	slots += spiQueueGetBurst(structSpiQueueTransmit, burst + slots * spiFormatActive->packetSize, 8 - slots);
+	ASSERT_EQ(spiLinkStamp(&master, burst, slots), 0);
+	ASSERT_EQ(master.sequenceNext, 2);
+	ASSERT_EQ(burst[SQ_RECORD_SEQUENCE_INDEX], 0);
+	uint8_t ids[SQ_RECORD_FIELDS_MAX];
+	union unionPayload values[SQ_RECORD_FIELDS_MAX];
+	ASSERT_EQ(spiRecordDecode(burst, ids, values), 4);
+	ASSERT_EQ(spiLinkReceive(&slave, burst), SQ_LINK_NEW);
+	uint8_t* filler = burst + (slots - 2) * spiFormatActive->packetSize;
+	uint8_t* frame = burst + (slots - 1) * spiFormatActive->packetSize;
+	ASSERT_EQ(spiFrameGetSequence(filler), 0);
+	ASSERT_EQ(spiFrameGetSequence(frame), 1);
+	ASSERT_EQ(spiLinkReceive(&slave, filler), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, filler), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slave, frame), SQ_LINK_NEW);
+	ASSERT_EQ(slave.metrics.lost, 0);
+	ASSERT_EQ(slave.metrics.duplicated, 0);
+	// format 1 frames have no sequence byte, every intact frame is new
+	ASSERT_EQ(spiFormatSet(SQ_FORMAT_V1), 0);
+	struct structSpiLink slaveV1 = {};
+	alignas(uint32_t) uint8_t frameV1[SQ_SLOT_SIZE];
+	ASSERT_EQ(spiQueuePost(structSpiQueueTransmit, ID_TEST_UINT8, 7), 0);
+	ASSERT_EQ(spiQueueGetBurst(structSpiQueueTransmit, frameV1, 1), 1);
+	ASSERT_EQ(spiLinkStamp(&master, frameV1, 1), 0);
+	ASSERT_EQ(master.sequenceNext, 2);
+	ASSERT_EQ(spiLinkReceive(&slaveV1, frameV1), SQ_LINK_NEW);
+	ASSERT_EQ(spiLinkReceive(&slaveV1, frameV1), SQ_LINK_NEW);
+	frameV1[spiFormatActive->payloadIndex] ^= 0x01;
+	ASSERT_EQ(spiLinkReceive(&slaveV1, frameV1), SQ_LINK_CRC_FAILED);
+	ASSERT_EQ(slaveV1.metrics.received, 2);
+	ASSERT_EQ(slaveV1.metrics.crcFailed, 1);
+	ASSERT_EQ(slaveV1.metrics.duplicated, 0);
+	ASSERT_EQ(spiQueueRemove(&structSpiQueueTransmit), 0);
+	ASSERT_EQ(errorVal, ec_no_error);
+}
+
+// SPIFILTER ----------------------------------------------------------------------------------------------------------------
+
+class spiFilterTest : public ::testing::Test {
+  protected:
+	spiFilterTest() {
+		errorReset();
+	}
+};
+
+TEST_F(spiFilterTest, spiFilter_deadband_refresh) {
+	RecordProperty("description_1", "Test if a value is held back within its deadband and goes out beyond it or after the refresh");
+	RecordProperty("description_2", "Test if values posted together go out together and ids without a refresh are never held back");
+	// both setpoints have a deadband of 0.1 kW and a refresh of 100 ms
+	struct structSpiFilter filter = {};
+	const uint8_t ids[] = {ID_SETPOINT_BATTERY_1, ID_SETPOINT_BATTERY_2};
+	double values[] = {500, -200};
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 2, 0), 1);
+	ASSERT_EQ(spiFilterSent(&filter, ids, values, 2, 0), 0);
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 2, 10), 0);
+	values[1] += 0.08;
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 2, 10), 0);
+	// one value beyond its deadband takes the other one along
+	values[1] += 0.04;
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 2, 20), 1);
+	ASSERT_EQ(spiFilterSent(&filter, ids, values, 2, 20), 0);
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 1, 20), 0);
+	values[0] -= 0.12;
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 1, 30), 1);
+	ASSERT_EQ(spiFilterSent(&filter, ids, values, 1, 30), 0);
+	// an unchanged value goes out again once its refresh is reached
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 1, 119), 0);
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 1, 120), 1);
+	ASSERT_EQ(spiFilterSent(&filter, ids + 1, values + 1, 1, 120), 0);
+	ASSERT_EQ(filter.metrics.passed, 6);
+	ASSERT_EQ(filter.metrics.held, 6);
+	// the tick may wrap between two values
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 1, UINT32_MAX), 1);
+	ASSERT_EQ(spiFilterSent(&filter, ids + 1, values + 1, 1, UINT32_MAX), 0);
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 1, 98), 0);
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 1, 99), 1);
+	const uint8_t plain[] = {ID_TEST_UINT8};
+	ASSERT_EQ(spiFilterPass(&filter, plain, values, 1, 0), 1);
+	ASSERT_EQ(spiFilterSent(&filter, plain, values, 1, 0), 0);
+	ASSERT_EQ(spiFilterPass(&filter, plain, values, 1, 0), 1);
+	ASSERT_EQ(spiFilterPass(NULL, plain, values, 1, 0), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
+}
+
+TEST_F(spiFilterTest, spiFilter_post_failed) {
+	RecordProperty("description_1", "Test if due values stay due until they are taken as sent");
+	RecordProperty("description_2", "Test if only ids with a refresh take one of the slots sized by the lexicon");
+	// only the four setpoints have a refresh
+	ASSERT_EQ(SQ_FILTER_SLOTS, 4);
+	struct structSpiFilter filter = {};
+	const uint8_t ids[] = {ID_TEST_UINT8, ID_SETPOINT_DG_1, ID_SETPOINT_DG_2};
+	const double values[] = {1, 250, 250};
+	ASSERT_EQ(spiFilterPass(&filter, ids, values, 3, 0), 1);
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 2, 10), 1);
+	ASSERT_EQ(filter.slots, 0);
+	ASSERT_EQ(spiFilterSent(&filter, ids, values, 3, 10), 0);
+	ASSERT_EQ(filter.slots, 2);
+	ASSERT_EQ(filter.identifier[0], ID_SETPOINT_DG_1);
+	ASSERT_EQ(spiFilterPass(&filter, ids + 1, values + 1, 2, 20), 0);
+	ASSERT_EQ(filter.metrics.passed, 3);
+	ASSERT_EQ(filter.metrics.held, 2);
+	ASSERT_EQ(spiFilterSent(NULL, ids, values, 3, 20), -1);
+	ASSERT_EQ(errorVal, ec_sq_doesnt_exist);
 }
 
 // MAIN ---------------------------------------------------------------------------------------------------------------------
@@ -7,6 +7,7 @@
  */
 
 #include "spiQueue.h"
+#include "crcTables.h"
 
 // ERROR --------------------------------------------------------------------------------------------------------------------
 
@@ -37,6 +38,7 @@ void errorReset(void) {
 // CRC ----------------------------------------------------------------------------------------------------------------------
 
 static void crcCalcTable(struct structCrcData* crcDataArg);
+static uint32_t crcUpdateSliced(const struct structCrcData* crcDataArg, uint32_t checksumArg, uint8_t arrayArg[], uint32_t arraySizeArg);
 static uint32_t crcReflect(uint32_t bitSequenceArg, uint8_t bitSequenceWidthArg);
 
 /**
@@ -67,6 +69,10 @@ int8_t crcInit(struct structCrcData* crcDataArg) {
 		errorCatcher(ec_crc_finalxor_oversized);
 		return -1;
 	}
+	if (!((crcDataArg->config.slicing <= 1) || (crcDataArg->config.slicing == 4) || (crcDataArg->config.slicing == 8))) {
+		errorCatcher(ec_crc_slicing_bad);
+		return -1;
+	}
 	crcDataArg->automatic.bitLengthMask = bitLengthMaskTemp;
 	crcCalcTable(crcDataArg);
 	return 0;
@@ -79,10 +85,10 @@ int8_t crcInit(struct structCrcData* crcDataArg) {
  * @param[in] arraySizeArg size of arrayarg
  * @retval checksum masked depending on crc bitlength
  */
-uint32_t crcCalcSlow(struct structCrcData* crcDataArg, uint8_t arrayArg[], uint8_t arraySizeArg) {
+uint32_t crcCalcSlow(const struct structCrcData* crcDataArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
 	uint32_t checksum = crcDataArg->config.initialValue;
 	uint32_t highestBitPos = 1 << (crcDataArg->config.bitLength - 1);
-	for (uint8_t byte = 0; byte < arraySizeArg; byte++) {
+	for (uint32_t byte = 0; byte < arraySizeArg; byte++) {
 		if (crcDataArg->config.inputReflected) {
 			checksum ^= crcReflect(arrayArg[byte], 8) << (crcDataArg->config.bitLength - 8);
 		} else {
@@ -109,23 +115,135 @@ uint32_t crcCalcSlow(struct structCrcData* crcDataArg, uint8_t arrayArg[], uint8
  * @param[in] arrayArg array pointer to frame
  * @param[in] arraySizeArg size of arrayarg
  * @retval checksum masked depending on crc bitlength
+ * @note - single piece stream, slicing-by-4 or slicing-by-8 when config.slicing is 4 or 8
+ */
+uint32_t crcCalcFast(const struct structCrcData* crcDataArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
+	struct structCrcStream stream;
+	crcBegin(&stream, crcDataArg);
+	crcUpdate(&stream, arrayArg, arraySizeArg);
+	return crcFinal(&stream);
+}
+
+/**
+ * @brief start a crc over data that arrives in pieces
+ * @param[out] streamArg stream to start
+ * @param[in] crcDataArg struct pointer containing crcdata config and data, has to outlive the stream
+ */
+void crcBegin(struct structCrcStream* streamArg, const struct structCrcData* crcDataArg) {
+	streamArg->crcDataPtr = crcDataArg;
+	if (crcDataArg->config.slicing <= 1) {
+		streamArg->checksum = crcDataArg->config.initialValue;
+	} else if (crcDataArg->config.inputReflected) {
+		streamArg->checksum = crcReflect(crcDataArg->config.initialValue, crcDataArg->config.bitLength);
+	} else {
+		streamArg->checksum = crcDataArg->config.initialValue << (32 - crcDataArg->config.bitLength);
+	}
+}
+
+/**
+ * @brief feed the next piece of data into a crc stream
+ * @param[in] streamArg stream started by crcbegin()
+ * @param[in] arrayArg array pointer to the next piece
+ * @param[in] arraySizeArg size of arrayarg, pieces may have any size
  */
-uint32_t crcCalcFast(struct structCrcData* crcDataArg, uint8_t arrayArg[], uint8_t arraySizeArg) {
+void crcUpdate(struct structCrcStream* streamArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
+	const struct structCrcData* crcDataArg = streamArg->crcDataPtr;
+	if (crcDataArg->config.slicing > 1) {
+		streamArg->checksum = crcUpdateSliced(crcDataArg, streamArg->checksum, arrayArg, arraySizeArg);
+		return;
+	}
 	uint8_t index;
-	uint32_t checksum = crcDataArg->config.initialValue;
-	for (uint8_t byte = 0; byte < arraySizeArg; byte++) {
+	uint32_t checksum = streamArg->checksum;
+	for (uint32_t byte = 0; byte < arraySizeArg; byte++) {
 		if (crcDataArg->config.inputReflected) {
-			index = crcReflect(arrayArg[byte], 8) ^ (checksum >> (crcDataArg->config.bitLength - 8));
+			index = crcDataArg->automatic.reflectTable[arrayArg[byte]] ^ (checksum >> (crcDataArg->config.bitLength - 8));
 		} else {
 			index = arrayArg[byte] ^ (checksum >> (crcDataArg->config.bitLength - 8));
 		}
 		checksum = crcDataArg->automatic.lookUpTable[index] ^ (checksum << 8);
 	}
-	if (crcDataArg->config.resultReflected) {
-		return (crcReflect(checksum, crcDataArg->config.bitLength) ^ crcDataArg->config.finalXorValue) & crcDataArg->automatic.bitLengthMask;
+	streamArg->checksum = checksum;
+}
+
+/**
+ * @brief finish a crc stream
+ * @param[in] streamArg stream started by crcbegin()
+ * @retval checksum masked depending on crc bitlength
+ * @note - the stream is left untouched, more data may follow for a running checksum
+ */
+uint32_t crcFinal(const struct structCrcStream* streamArg) {
+	const struct structCrcData* crcDataArg = streamArg->crcDataPtr;
+	uint32_t checksum = streamArg->checksum;
+	if (crcDataArg->config.slicing <= 1) {
+		if (crcDataArg->config.resultReflected) {
+			checksum = crcReflect(checksum, crcDataArg->config.bitLength);
+		}
 	} else {
-		return (checksum ^ crcDataArg->config.finalXorValue) & crcDataArg->automatic.bitLengthMask;
+		if (!crcDataArg->config.inputReflected) {
+			checksum >>= 32 - crcDataArg->config.bitLength;
+		}
+		// the checksum is reflected exactly when the input was, reflect once more if the result asks for the other order
+		if (crcDataArg->config.inputReflected != crcDataArg->config.resultReflected) {
+			checksum = crcReflect(checksum, crcDataArg->config.bitLength);
+		}
+	}
+	return (checksum ^ crcDataArg->config.finalXorValue) & crcDataArg->automatic.bitLengthMask;
+}
+
+/**
+ * @brief advance a checksum using slicing-by-4 or slicing-by-8, 4 or 8 bytes per step
+ * @param[in] crcDataArg struct pointer containing crcdata config and data
+ * @param[in] checksumArg running checksum, low bits reflected for reflected input and high bits otherwise
+ * @param[in] arrayArg array pointer to frame
+ * @param[in] arraySizeArg size of arrayarg
+ * @retval running checksum in the same order as checksumarg
+ * @note - reflected input runs the reflected algorithm on reflected tables, so no byte is reflected at runtime
+ * @note - the remaining bytes after the last full step go through slicetable[0] one by one
+ */
+static uint32_t crcUpdateSliced(const struct structCrcData* crcDataArg, uint32_t checksumArg, uint8_t arrayArg[], uint32_t arraySizeArg) {
+	const uint32_t(*table)[256] = crcDataArg->automatic.sliceTable;
+	uint32_t byte = 0;
+	uint32_t checksum = checksumArg;
+	if (crcDataArg->config.inputReflected) {
+		// checksum sits in the low bits, words are read little endian
+		if (crcDataArg->config.slicing == 8) {
+			for (; byte + 8 <= arraySizeArg; byte += 8) {
+				uint8_t* in = arrayArg + byte;
+				uint32_t low = checksum ^ (in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24);
+				uint32_t high = in[4] | (uint32_t)in[5] << 8 | (uint32_t)in[6] << 16 | (uint32_t)in[7] << 24;
+				checksum = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+						   table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+			}
+		}
+		for (; byte + 4 <= arraySizeArg; byte += 4) {
+			uint8_t* in = arrayArg + byte;
+			uint32_t word = checksum ^ (in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24);
+			checksum = table[3][word & 0xFF] ^ table[2][(word >> 8) & 0xFF] ^ table[1][(word >> 16) & 0xFF] ^ table[0][word >> 24];
+		}
+		for (; byte < arraySizeArg; byte++) {
+			checksum = table[0][(checksum ^ arrayArg[byte]) & 0xFF] ^ (checksum >> 8);
+		}
+	} else {
+		// checksum sits in the high bits, words are read big endian
+		if (crcDataArg->config.slicing == 8) {
+			for (; byte + 8 <= arraySizeArg; byte += 8) {
+				uint8_t* in = arrayArg + byte;
+				uint32_t high = checksum ^ ((uint32_t)in[0] << 24 | (uint32_t)in[1] << 16 | (uint32_t)in[2] << 8 | in[3]);
+				uint32_t low = (uint32_t)in[4] << 24 | (uint32_t)in[5] << 16 | (uint32_t)in[6] << 8 | in[7];
+				checksum = table[7][high >> 24] ^ table[6][(high >> 16) & 0xFF] ^ table[5][(high >> 8) & 0xFF] ^ table[4][high & 0xFF] ^
+						   table[3][low >> 24] ^ table[2][(low >> 16) & 0xFF] ^ table[1][(low >> 8) & 0xFF] ^ table[0][low & 0xFF];
+			}
+		}
+		for (; byte + 4 <= arraySizeArg; byte += 4) {
+			uint8_t* in = arrayArg + byte;
+			uint32_t word = checksum ^ ((uint32_t)in[0] << 24 | (uint32_t)in[1] << 16 | (uint32_t)in[2] << 8 | in[3]);
+			checksum = table[3][word >> 24] ^ table[2][(word >> 16) & 0xFF] ^ table[1][(word >> 8) & 0xFF] ^ table[0][word & 0xFF];
+		}
+		for (; byte < arraySizeArg; byte++) {
+			checksum = table[0][(checksum >> 24) ^ arrayArg[byte]] ^ (checksum << 8);
+		}
 	}
+	return checksum;
 }
 
 /**
@@ -162,6 +280,30 @@ static void crcCalcTable(struct structCrcData* crcDataArg) {
 			}
 		}
 		crcDataArg->automatic.lookUpTable[byte] = checksum & crcDataArg->automatic.bitLengthMask;
+		crcDataArg->automatic.reflectTable[byte] = crcReflect(byte, 8);
+	}
+	if (crcDataArg->config.slicing <= 1) {
+		return;
+	}
+	// slice 0 is the lookup table in the order crcupdatesliced() walks the checksum
+	uint8_t shift = 32 - crcDataArg->config.bitLength;
+	for (uint16_t byte = 0; byte < 256; byte++) {
+		if (crcDataArg->config.inputReflected) {
+			crcDataArg->automatic.sliceTable[0][byte] = crcReflect(crcDataArg->automatic.lookUpTable[crcDataArg->automatic.reflectTable[byte]], crcDataArg->config.bitLength);
+		} else {
+			crcDataArg->automatic.sliceTable[0][byte] = crcDataArg->automatic.lookUpTable[byte] << shift;
+		}
+	}
+	// slice n advances slice n-1 by one more zero byte
+	for (uint8_t slice = 1; slice < crcDataArg->config.slicing; slice++) {
+		for (uint16_t byte = 0; byte < 256; byte++) {
+			uint32_t previous = crcDataArg->automatic.sliceTable[slice - 1][byte];
+			if (crcDataArg->config.inputReflected) {
+				crcDataArg->automatic.sliceTable[slice][byte] = (previous >> 8) ^ crcDataArg->automatic.sliceTable[0][previous & 0xFF];
+			} else {
+				crcDataArg->automatic.sliceTable[slice][byte] = (previous << 8) ^ crcDataArg->automatic.sliceTable[0][previous >> 24];
+			}
+		}
 	}
 }
 
@@ -171,7 +313,7 @@ static void crcCalcTable(struct structCrcData* crcDataArg) {
  * @param[in] hexOutputArg print as hex if true, else as decimal
  * @param[in] tableFormatArg print into a block if true, else long string
  */
-void crcCalcTablePrint(struct structCrcData* crcDataArg, bool hexOutputArg, bool tableFormatArg) {
+void crcCalcTablePrint(const struct structCrcData* crcDataArg, bool hexOutputArg, bool tableFormatArg) {
 	uint16_t index = 0;
 	uint8_t columns = 0;
 	PRINT("\x1B[30;47m\n// clang-format off\n");
@@ -205,12 +347,17 @@ void crcCalcTablePrint(struct structCrcData* crcDataArg, bool hexOutputArg, bool
 
 // SPIQUEUE -----------------------------------------------------------------------------------------------------------------
 
-/** @brief structure definition for the lexicon */
+/** @brief structure definition for the lexicon, indexed directly by id */
 struct structLexicon {
-	uint8_t identifier;		  /**< ID code */
-	uint8_t dataType;		  /**< C datatype */
-	uint8_t varString[32];	  /**< Printable variable name */
-	uint8_t varUnitString[8]; /**< Printable variable unit specifier */
+	uint8_t dataType;			/**< C datatype, x for ids without an entry */
+	uint8_t size;				/**< payload bytes used by the datatype */
+	uint8_t priority;			/**< spiqueue priority class */
+	const char* varString;		/**< Printable variable name */
+	const char* varUnitString;	/**< Printable variable unit specifier */
+	int32_t scale;				/**< thousandths of the unit per fixed-point count */
+	int32_t offset;				/**< thousandths of the unit at fixed-point count zero */
+	int32_t deadband;			/**< thousandths of the unit a value has to move before it is sent again */
+	uint32_t refresh;			/**< ms after which an unchanged value is sent again, 0 for ids that are not filtered */
 };
 
 /** @brief supported datatypes */
@@ -225,48 +372,32 @@ enum lexiconDataTypes {
 	SINT32, /**< signed integer 32bit */
 	FRAC32, /**< float */
 	FRAC64, /**< double */
+	RECORD, /**< record frame, laid out by sq_records */
+	FIXED,	/**< pair of scaled int32 counts, laid out by sq_pairs */
 };
 
-// clang-format off
-/** @brief lexicon with easily recognizable structure columns */
-const struct structLexicon lexicon[] = {
-// BAD IDs
-	{0x00, X,		"X",					"X"			},
-	{0xFF, X,		"X",					"X"			},
-
-// FILLER	
-	{0x01, UINT8,	"Filler",				"F"			},
-
-// TEST	
-	{0xA0, UINT8,	"Test UINT8",			"T"			},
-	{0xA1, UINT16,	"Test UINT16",			"T"			},
-	{0xA2, UINT32,	"Test UINT32",			"T"			},
-	{0xA3, SINT8,	"Test SINT8",			"T"			},
-	{0xA4, SINT16,	"Test SINT16",			"T"			},
-	{0xA5, SINT32,	"Test SINT32",			"T"			},
-	{0xA6, FRAC32,	"Test FRAC32",			"T"			},
-	{0xA7, FRAC64,	"Test FRAC64",			"T"			},
-	{0xA8, BINARY,	"Test BINARY",			"T"			},
-	{0xA9, UINT32,	"Test latency",			"100us"		},
-
-// OUTBOUND	
-	{0xB1, FRAC64,	"Setpoint battery 1",	"kW"		},
-	{0xB2, FRAC64,	"Setpoint battery 2",	"kW"		},
-	{0xB3, FRAC64,	"Setpoint DG 1",		"kW"		},
-	{0xB4, FRAC64,	"Setpoint DG 2",		"kW"		},
-
-// INBOUND	
-	{0xC1, FRAC64,	"Power battery 1",		"kW"		},
-	{0xC2, FRAC64,	"Power battery 2",		"kW"		},
-	{0xC3, FRAC32,	"SOC battery 1",		"%%"		},
-	{0xC4, FRAC32,	"SOC battery 2",		"%%"		},
-	{0xC5, UINT32,	"Power DG 1",			"kW"		},
-	{0xC6, UINT32,	"Power DG 2",			"kW"		},
-	{0xC7, FRAC32,	"SFOC 1",				"gr/kWh"	},
-	{0xC8, FRAC32,	"SFOC 2",				"gr/kWh"	},
-	{0xC9, UINT8,	"OPstate",				"enum"		}
-};
-// clang-format on
+/** @brief payload bytes per datatype, pasted together with the datatype name by sq_lexicon_entry */
+#define SQ_SIZE_X 0
+#define SQ_SIZE_BINARY 1
+#define SQ_SIZE_UINT8 1
+#define SQ_SIZE_UINT16 2
+#define SQ_SIZE_UINT32 4
+#define SQ_SIZE_SINT8 1
+#define SQ_SIZE_SINT16 2
+#define SQ_SIZE_SINT32 4
+#define SQ_SIZE_FRAC32 4
+#define SQ_SIZE_FRAC64 8
+#define SQ_SIZE_RECORD 0
+#define SQ_SIZE_FIXED 8
+
+/** @brief turns a row of sq_lexicon in spiqueue.h into the lexicon entry at index id */
+#define SQ_LEXICON_ENTRY(NAME, EMS_NAME, ID, TYPE, PRIORITY, STRING, UNIT, SCALE, OFFSET, DEADBAND, REFRESH) [ID] = {TYPE, SQ_SIZE_##TYPE, PRIORITY, STRING, UNIT, SCALE, OFFSET, DEADBAND, REFRESH},
+
+/**
+ * @brief lexicon with one entry for every possible id, so a lookup is a single index
+ * @note - ids without a row are zero filled, which reads as datatype x
+ */
+const struct structLexicon lexicon[256] = {SQ_LEXICON(SQ_LEXICON_ENTRY)};
 
 /**
  * @brief allocates memory and initialises a spiqueue according to the structspiqueue layout
@@ -274,6 +405,8 @@ const struct structLexicon lexicon[] = {
  * @param[in] sizeMaxArg maximum amount of packets the spiqueue may hold
  * @retval 0 on success, -1 on failure
  * @note - equipped with errorCatcher()
+ * @note - the packet pool of sizemaxarg packets is allocated in the same block as the spiqueue,
+ * after this call no further heap calls are made until spiqueueremove()
  */
 int8_t spiQueueCreate(struct structSpiQueue** structSpiQueuePtrArg, uint8_t sizeMaxArg) {
 	// check if spiqueue already exists
@@ -281,8 +414,8 @@ int8_t spiQueueCreate(struct structSpiQueue** structSpiQueuePtrArg, uint8_t size
 		errorCatcher(ec_sq_already_exist);
 		return -1;
 	}
-	// malloc new spiqueue
-	struct structSpiQueue* newStructSpiQueue = malloc(sizeof(struct structSpiQueue));
+	// malloc new spiqueue with its packet pool directly behind it
+	struct structSpiQueue* newStructSpiQueue = malloc(SQ_POOL_OFFSET + sizeMaxArg * sizeof(struct structPacket));
 	// check if malloc was successful
 	if (newStructSpiQueue == NULL) {
 		errorCatcher(ec_sq_malloc_failed);
@@ -291,8 +424,29 @@ int8_t spiQueueCreate(struct structSpiQueue** structSpiQueuePtrArg, uint8_t size
 	// initialize spiqueue default fields
 	newStructSpiQueue->sizeCurrent = 0;
 	newStructSpiQueue->sizeMax = sizeMaxArg;
+	newStructSpiQueue->mode = SQ_MODE_FIFO;
+	newStructSpiQueue->scheduler = SQ_SCHEDULER_FIFO;
+	newStructSpiQueue->overflow = SQ_OVERFLOW_DROP_NEWEST;
+	newStructSpiQueue->timeout = 0;
+	newStructSpiQueue->waitingTaskPtr = NULL;
+	newStructSpiQueue->consumerTaskPtr = NULL;
 	newStructSpiQueue->headPacketPtr = NULL;
 	newStructSpiQueue->tailPacketPtr = NULL;
+	// initialize empty priority classes
+	memset(newStructSpiQueue->classes, 0, sizeof(newStructSpiQueue->classes));
+	for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+		newStructSpiQueue->classes[priority].weight = 1;
+		newStructSpiQueue->classes[priority].credit = 1;
+	}
+	// start with clean health counters
+	memset(&newStructSpiQueue->metrics, 0, sizeof(newStructSpiQueue->metrics));
+	// chain all pool packets into the free list
+	newStructSpiQueue->poolPacketPtr = (struct structPacket*)((uint8_t*)newStructSpiQueue + SQ_POOL_OFFSET);
+	newStructSpiQueue->freePacketPtr = NULL;
+	for (uint16_t index = sizeMaxArg; index > 0; index--) {
+		newStructSpiQueue->poolPacketPtr[index - 1].nextPacketPtr = newStructSpiQueue->freePacketPtr;
+		newStructSpiQueue->freePacketPtr = &newStructSpiQueue->poolPacketPtr[index - 1];
+	}
 	// set address of malloced spiqueue to argument pointer
 	*structSpiQueuePtrArg = newStructSpiQueue;
 	return 0;
@@ -310,14 +464,7 @@ int8_t spiQueueRemove(struct structSpiQueue** structSpiQueuePtrArg) {
 		errorCatcher(ec_sq_doesnt_exist);
 		return -1;
 	}
-	// remove all packets
-	while ((*structSpiQueuePtrArg)->headPacketPtr != NULL) {
-		if (spiQueuePacketRemove(*structSpiQueuePtrArg)) {
-			errorCatcher(ec_sq_remove_failed);
-			return -1;
-		}
-	}
-	// free spiqueue
+	// free spiqueue, the packets live in the pool of the same allocation
 	free(*structSpiQueuePtrArg);
 	// zero the address
 	*structSpiQueuePtrArg = NULL;
@@ -325,7 +472,285 @@ int8_t spiQueueRemove(struct structSpiQueue** structSpiQueuePtrArg) {
 }
 
 /**
- * @brief allocates memory and initialises a packet according to the structpacket layout
+ * @brief selects how posts are added to the spiqueue
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] modeArg mode from spiqueuemodes
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - only allowed while the spiqueue is empty
+ */
+int8_t spiQueueModeSet(struct structSpiQueue* structSpiQueuePtrArg, uint8_t modeArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	// check if mode is known and spiqueue is empty
+	if (modeArg > SQ_MODE_MAILBOX || structSpiQueuePtrArg->sizeCurrent > 0) {
+		errorCatcher(ec_sq_mode_bad);
+		return -1;
+	}
+	structSpiQueuePtrArg->mode = modeArg;
+	return 0;
+}
+
+/**
+ * @brief selects in which order the priority classes are served
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] schedulerArg scheduler from spiqueueschedulers
+ * @param[in] weightArg number of packets per class and weighted round, indexed by spiqueuepriorities. only used for weighted
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - only allowed while the spiqueue is empty, weights must be at least 1
+ */
+int8_t spiQueueSchedulerSet(struct structSpiQueue* structSpiQueuePtrArg, uint8_t schedulerArg, const uint8_t weightArg[]) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	// check if scheduler is known and spiqueue is empty
+	if (schedulerArg > SQ_SCHEDULER_WEIGHTED || structSpiQueuePtrArg->sizeCurrent > 0) {
+		errorCatcher(ec_sq_scheduler_bad);
+		return -1;
+	}
+	if (schedulerArg == SQ_SCHEDULER_WEIGHTED) {
+		// a class without weight would starve
+		if (weightArg == NULL) {
+			errorCatcher(ec_sq_scheduler_bad);
+			return -1;
+		}
+		for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+			if (weightArg[priority] == 0) {
+				errorCatcher(ec_sq_scheduler_bad);
+				return -1;
+			}
+		}
+		for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+			structSpiQueuePtrArg->classes[priority].weight = weightArg[priority];
+			structSpiQueuePtrArg->classes[priority].credit = weightArg[priority];
+		}
+	}
+	structSpiQueuePtrArg->scheduler = schedulerArg;
+	return 0;
+}
+
+/**
+ * @brief find the priority class in the lexicon for the specified id
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @retval priority class, normal for ids without a lexicon entry
+ */
+static uint8_t spiQueueFindPriority(uint8_t identifierArg) {
+	if (lexicon[identifierArg].varString == NULL) {
+		return SQ_PRIO_NORMAL;
+	}
+	return lexicon[identifierArg].priority;
+}
+
+/**
+ * @brief picks the packet that leaves the spiqueue next according to the scheduler
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @retval pointer to the first packet of the selected class, null when empty
+ */
+static struct structPacket* spiQueueSelect(struct structSpiQueue* structSpiQueuePtrArg) {
+	struct structSpiQueueClass* classes = structSpiQueuePtrArg->classes;
+	if (structSpiQueuePtrArg->sizeCurrent == 0) {
+		return NULL;
+	}
+	if (structSpiQueuePtrArg->scheduler == SQ_SCHEDULER_WEIGHTED) {
+		// the highest class with packets and credit left goes first, all credits are refilled when none is left
+		for (uint8_t pass = 0; pass < 2; pass++) {
+			for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+				if (classes[priority].headPacketPtr != NULL && classes[priority].credit > 0) {
+					return classes[priority].headPacketPtr;
+				}
+			}
+			for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+				classes[priority].credit = classes[priority].weight;
+			}
+		}
+	}
+	// strict, the highest class with packets goes first
+	for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+		if (classes[priority].headPacketPtr != NULL) {
+			return classes[priority].headPacketPtr;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief selects what a post does when the spiqueue is full
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] overflowArg overflow policy from spiqueueoverflows
+ * @param[in] timeoutArg ticks a blocked post waits for room, only used by sq_overflow_block
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - only allowed while the spiqueue is empty, so right after spiqueuecreate()
+ * @note - only a single task may be blocked on a spiqueue at a time, a second one is not woken and times out
+ */
+int8_t spiQueueOverflowSet(struct structSpiQueue* structSpiQueuePtrArg, uint8_t overflowArg, uint32_t timeoutArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	// check if overflow policy is known and spiqueue is empty
+	if (overflowArg > SQ_OVERFLOW_BLOCK || structSpiQueuePtrArg->sizeCurrent > 0) {
+		errorCatcher(ec_sq_overflow_bad);
+		return -1;
+	}
+	structSpiQueuePtrArg->overflow = overflowArg;
+	structSpiQueuePtrArg->timeout = timeoutArg;
+	return 0;
+}
+
+/**
+ * @brief selects the task woken when a post fills the empty spiqueue
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] taskArg task handle of the consumer, null to stop waking
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - posts by the consumer itself, like the filler of spiqueuegetarray(), don't wake it
+ */
+int8_t spiQueueConsumerSet(struct structSpiQueue* structSpiQueuePtrArg, void* taskArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	structSpiQueuePtrArg->consumerTaskPtr = taskArg;
+	return 0;
+}
+
+/**
+ * @brief takes a snapshot of the health counters of the spiqueue
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[out] metricsArg pointer to the struct to copy the counters to
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - dwell times are in getcycles() ticks, the dwell fields stay zero until a packet has left
+ */
+int8_t spiQueueMetricsGet(struct structSpiQueue* structSpiQueuePtrArg, struct structSpiQueueMetrics* metricsArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	*metricsArg = structSpiQueuePtrArg->metrics;
+	metricsArg->sizeCurrent = structSpiQueuePtrArg->sizeCurrent;
+	if (metricsArg->gets > 0) {
+		metricsArg->dwellMean = metricsArg->dwellSum / metricsArg->gets;
+	}
+	return 0;
+}
+
+/**
+ * @brief clears the health counters of the spiqueue
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - the peak restarts at the current number of packets, pending packets keep their timestamp
+ */
+int8_t spiQueueMetricsReset(struct structSpiQueue* structSpiQueuePtrArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	memset(&structSpiQueuePtrArg->metrics, 0, sizeof(structSpiQueuePtrArg->metrics));
+	structSpiQueuePtrArg->metrics.sizePeak = structSpiQueuePtrArg->sizeCurrent;
+	return 0;
+}
+
+/**
+ * @brief finds the pending packet with the specified id inside a priority class
+ * @param[in] packetClassArg pointer to the priority class
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @retval pointer to the packet, null when the id is not pending
+ */
+static struct structPacket* spiQueuePacketFind(struct structSpiQueueClass* packetClassArg, uint8_t identifierArg) {
+	for (struct structPacket* packet = packetClassArg->headPacketPtr; packet != NULL; packet = packet->nextPacketPtr) {
+		if (packet->identifier == identifierArg) {
+			return packet;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief appends a packet taken from the pool to the tail of its priority class
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] packetArg pointer to the packet, its priority must be set
+ * @note - headpacketptr is not updated, call spiqueueselect() afterwards
+ */
+static void spiQueuePacketLink(struct structSpiQueue* structSpiQueuePtrArg, struct structPacket* packetArg) {
+	struct structSpiQueueClass* packetClass = &structSpiQueuePtrArg->classes[packetArg->priority];
+	packetArg->nextPacketPtr = NULL;
+	packetArg->timestamp = GETCYCLES();
+	if (packetClass->tailPacketPtr == NULL) {
+		packetClass->headPacketPtr = packetArg;
+	} else {
+		packetClass->tailPacketPtr->nextPacketPtr = packetArg;
+	}
+	packetClass->tailPacketPtr = packetArg;
+	packetClass->sizeCurrent++;
+	if (packetClass->sizeCurrent > packetClass->sizePeak) {
+		packetClass->sizePeak = packetClass->sizeCurrent;
+	}
+	structSpiQueuePtrArg->sizeCurrent++;
+	structSpiQueuePtrArg->metrics.posts++;
+	// only the first packet wakes the consumer, it keeps getting until the spiqueue is empty again
+	if (structSpiQueuePtrArg->sizeCurrent == 1 && structSpiQueuePtrArg->consumerTaskPtr != NULL && structSpiQueuePtrArg->consumerTaskPtr != SQ_TASK()) {
+		SQ_NOTIFY(structSpiQueuePtrArg->consumerTaskPtr);
+	}
+	if (structSpiQueuePtrArg->sizeCurrent > structSpiQueuePtrArg->metrics.sizePeak) {
+		structSpiQueuePtrArg->metrics.sizePeak = structSpiQueuePtrArg->sizeCurrent;
+	}
+}
+
+/**
+ * @brief copies the packet fields into a frame in wire layout
+ * @param[in] packetArg pointer to the packet
+ * @param[out] arrayArg frame in wire layout
+ */
+static void spiQueuePacketToArray(struct structPacket* packetArg, uint8_t arrayArg[]) {
+	const struct structSpiFormat* format = spiFormatActive;
+	// get id
+	memcpy(arrayArg + SQ_ID_INDEX, &(packetArg->identifier), SQ_ID_SIZE);
+	// get sequence, formats without a sequence byte copy nothing
+	memcpy(arrayArg + format->sequenceIndex, &(packetArg->sequence), format->sequenceSize);
+	// get payload
+	memcpy(arrayArg + format->payloadIndex, packetArg->payload.uint8, SQ_PAYLOAD_SIZE);
+	// get ack
+	memcpy(arrayArg + format->ackIndex, packetArg->ack.returnCrc.uint8, SQ_ACK_SIZE);
+	// get crc
+	memcpy(arrayArg + format->crcIndex, packetArg->crc.value.uint8, SQ_CRC_SIZE);
+	// zero the padding up to the whole word
+	memset(arrayArg + format->crcIndex + SQ_CRC_SIZE, 0, format->packetSize - format->crcIndex - SQ_CRC_SIZE);
+}
+
+/**
+ * @brief sets the packet fields from a frame in wire layout
+ * @param[in] packetArg pointer to the packet to fill
+ * @param[in] arrayArg frame in wire layout
+ */
+static void spiQueuePacketFill(struct structPacket* packetArg, uint8_t arrayArg[]) {
+	const struct structSpiFormat* format = spiFormatActive;
+	packetArg->identifier = arrayArg[SQ_ID_INDEX];
+	packetArg->sequence = 0;
+	memcpy(&(packetArg->sequence), arrayArg + format->sequenceIndex, format->sequenceSize);
+	memcpy(packetArg->payload.uint8, arrayArg + format->payloadIndex, SQ_PAYLOAD_SIZE);
+	memcpy(packetArg->ack.returnCrc.uint8, arrayArg + format->ackIndex, SQ_ACK_SIZE);
+	memcpy(packetArg->crc.value.uint8, arrayArg + format->crcIndex, SQ_CRC_SIZE);
+	packetArg->crc.verified = false;
+	packetArg->crc.good = false;
+	packetArg->ack.retrieved = false;
+}
+
+/**
+ * @brief takes a packet from the packet pool and initialises it according to the structpacket layout
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
  * @param[in] arrayArg 	[0]: predefined id recorded by the lexicon used to distinguish variables as they turn abstracted while in spi transfer.
  *  					[1-8]: unpacked datatype bytes making up a variable value
  * 						[9-10]: ack value
@@ -333,28 +758,92 @@ int8_t spiQueueRemove(struct structSpiQueue** structSpiQueuePtrArg) {
  * @retval pointer to the new packet
  * @note - equipped with errorcatcher()
  */
-static struct structPacket* spiQueuePacketAppend(uint8_t arrayArg[]) {
-	// malloc new packet
-	struct structPacket* newPacket = malloc(sizeof(struct structPacket));
-	// check if malloc was successful
+static struct structPacket* spiQueuePacketAppend(struct structSpiQueue* structSpiQueuePtrArg, uint8_t arrayArg[]) {
+	// pop packet from the free list
+	struct structPacket* newPacket = structSpiQueuePtrArg->freePacketPtr;
+	// check if the pool was not exhausted
 	if (newPacket == NULL) {
 		errorCatcher(ec_sq_packet_malloc_failed);
 		return NULL;
 	}
+	structSpiQueuePtrArg->freePacketPtr = newPacket->nextPacketPtr;
 	// set newpacket fields from array data
-	newPacket->identifier = arrayArg[SQ_ID_INDEX];
-	memcpy(newPacket->payload.uint8, arrayArg + SQ_PAYLOAD_INDEX, SQ_PAYLOAD_SIZE);
-	memcpy(newPacket->ack.returnCrc.uint8, arrayArg + SQ_ACK_INDEX, SQ_ACK_SIZE);
-	memcpy(newPacket->crc.value.uint8, arrayArg + SQ_CRC_INDEX, SQ_CRC_SIZE);
-	// initialize newpacket fields
-	newPacket->crc.verified = false;
-	newPacket->crc.good = false;
-	newPacket->ack.retrieved = false;
+	spiQueuePacketFill(newPacket, arrayArg);
 	newPacket->nextPacketPtr = NULL;
 	// return packet
 	return newPacket;
 }
 
+/**
+ * @brief drops the oldest packet of a priority class to make room for a newer one
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] packetClassArg pointer to the priority class, must hold a packet
+ * @note - headpacketptr is not updated, call spiqueueselect() afterwards
+ */
+static void spiQueuePacketEvict(struct structSpiQueue* structSpiQueuePtrArg, struct structSpiQueueClass* packetClassArg) {
+	struct structPacket* packet = packetClassArg->headPacketPtr;
+	packetClassArg->headPacketPtr = packet->nextPacketPtr;
+	if (packetClassArg->headPacketPtr == NULL) {
+		packetClassArg->tailPacketPtr = NULL;
+	}
+	packetClassArg->sizeCurrent--;
+	structSpiQueuePtrArg->sizeCurrent--;
+	if (structSpiQueuePtrArg->tailPacketPtr == packet) {
+		structSpiQueuePtrArg->tailPacketPtr = NULL;
+	}
+	packet->nextPacketPtr = structSpiQueuePtrArg->freePacketPtr;
+	structSpiQueuePtrArg->freePacketPtr = packet;
+	structSpiQueuePtrArg->metrics.drops[SQ_DROP_OLDEST]++;
+}
+
+/**
+ * @brief makes room for new packets according to the overflow policy of the spiqueue
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] countArg number of new packets
+ * @param[in] priorityArg priority class of the new packets, packets of higher classes are never dropped for them
+ * @retval 0 when there is room, -1 when the new packets are dropped
+ * @note - equipped with errorcatcher()
+ * @note - a blocked post waits up to the timeout for every single packet that has to leave
+ */
+static int8_t spiQueueMakeRoom(struct structSpiQueue* structSpiQueuePtrArg, uint8_t countArg, uint8_t priorityArg) {
+	uint8_t reason = SQ_DROP_FULL;
+	switch (structSpiQueuePtrArg->overflow) {
+	case SQ_OVERFLOW_DROP_OLDEST:
+		// drop from the lowest class upwards until there is room or only higher classes are left
+		for (uint8_t priority = SQ_PRIO_CLASSES; priority > priorityArg && countArg > structSpiQueuePtrArg->sizeMax - structSpiQueuePtrArg->sizeCurrent;) {
+			if (structSpiQueuePtrArg->classes[priority - 1].headPacketPtr == NULL) {
+				priority--;
+				continue;
+			}
+			spiQueuePacketEvict(structSpiQueuePtrArg, &structSpiQueuePtrArg->classes[priority - 1]);
+		}
+		structSpiQueuePtrArg->headPacketPtr = spiQueueSelect(structSpiQueuePtrArg);
+		break;
+	case SQ_OVERFLOW_BLOCK:
+		// every get notifies the waiting task, which checks again
+		reason = SQ_DROP_TIMEOUT;
+		if (countArg > structSpiQueuePtrArg->sizeMax - structSpiQueuePtrArg->sizeCurrent && structSpiQueuePtrArg->waitingTaskPtr == NULL) {
+			structSpiQueuePtrArg->metrics.blocks++;
+			structSpiQueuePtrArg->waitingTaskPtr = SQ_TASK();
+			while (countArg > structSpiQueuePtrArg->sizeMax - structSpiQueuePtrArg->sizeCurrent) {
+				if (!SQ_WAIT(structSpiQueuePtrArg, structSpiQueuePtrArg->timeout)) {
+					break;
+				}
+			}
+			structSpiQueuePtrArg->waitingTaskPtr = NULL;
+		}
+		break;
+	default:
+		break;
+	}
+	if (countArg > structSpiQueuePtrArg->sizeMax - structSpiQueuePtrArg->sizeCurrent) {
+		errorCatcher(ec_sq_full);
+		structSpiQueuePtrArg->metrics.drops[reason] += countArg;
+		return -1;
+	}
+	return 0;
+}
+
 /**
  * @brief remove a packet from the head of the spiqueue
  * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
@@ -367,18 +856,40 @@ int8_t spiQueuePacketRemove(struct structSpiQueue* structSpiQueuePtrArg) {
 		errorCatcher(ec_sq_no_packet_exists);
 		return -1;
 	}
-	// when single frame reset head and tail ptrs to null
-	if (structSpiQueuePtrArg->headPacketPtr == structSpiQueuePtrArg->tailPacketPtr) {
-		structSpiQueuePtrArg->sizeCurrent--;
-		free(structSpiQueuePtrArg->headPacketPtr);
-		structSpiQueuePtrArg->headPacketPtr = NULL;
+	struct structPacket* previousheadPacketPtr = structSpiQueuePtrArg->headPacketPtr;
+	// the head is always the first packet of its class, move the class head
+	struct structSpiQueueClass* packetClass = &structSpiQueuePtrArg->classes[previousheadPacketPtr->priority];
+	packetClass->headPacketPtr = previousheadPacketPtr->nextPacketPtr;
+	if (packetClass->headPacketPtr == NULL) {
+		packetClass->tailPacketPtr = NULL;
+	}
+	packetClass->sizeCurrent--;
+	if (packetClass->credit > 0) {
+		packetClass->credit--;
+	}
+	structSpiQueuePtrArg->sizeCurrent--;
+	if (structSpiQueuePtrArg->tailPacketPtr == previousheadPacketPtr) {
 		structSpiQueuePtrArg->tailPacketPtr = NULL;
-		// when multiple frames move head ptr
-	} else {
-		struct structPacket* previousheadPacketPtr = structSpiQueuePtrArg->headPacketPtr;
-		structSpiQueuePtrArg->headPacketPtr = structSpiQueuePtrArg->headPacketPtr->nextPacketPtr;
-		structSpiQueuePtrArg->sizeCurrent--;
-		free(previousheadPacketPtr);
+	}
+	// keep track of the time the packet spent inside the spiqueue
+	struct structSpiQueueMetrics* metrics = &structSpiQueuePtrArg->metrics;
+	uint32_t dwell = GETCYCLES() - previousheadPacketPtr->timestamp;
+	metrics->gets++;
+	if (metrics->gets == 1 || dwell < metrics->dwellMin) {
+		metrics->dwellMin = dwell;
+	}
+	if (dwell > metrics->dwellMax) {
+		metrics->dwellMax = dwell;
+	}
+	metrics->dwellSum += dwell;
+	// select the packet to leave next
+	structSpiQueuePtrArg->headPacketPtr = spiQueueSelect(structSpiQueuePtrArg);
+	// push packet back onto the free list
+	previousheadPacketPtr->nextPacketPtr = structSpiQueuePtrArg->freePacketPtr;
+	structSpiQueuePtrArg->freePacketPtr = previousheadPacketPtr;
+	// a post blocked on the full spiqueue can continue
+	if (structSpiQueuePtrArg->waitingTaskPtr != NULL) {
+		SQ_WAKE(structSpiQueuePtrArg->waitingTaskPtr);
 	}
 	return 0;
 }
@@ -394,6 +905,9 @@ int8_t spiQueuePacketRemove(struct structSpiQueue* structSpiQueuePtrArg) {
  * @param[in] crcCheckArg check crc value if set
  * @retval 0 on success, -1 on failure
  * @note - equipped with errorcatcher()
+ * @note - in mailbox mode a full spiqueue still accepts ids that are already pending
+ * @note - posting may change headpacketptr when a higher priority class overtakes it, so a post between
+ * spiqueuegetarray() and spiqueuepacketremove() removes a different packet than the one retrieved
  */
 int8_t spiQueuePostArray(struct structSpiQueue* structSpiQueuePtrArg, uint8_t arrayArg[], uint8_t arraySizeArg, bool crcCheckArg) {
 	// check if spiqueue exists
@@ -401,42 +915,49 @@ int8_t spiQueuePostArray(struct structSpiQueue* structSpiQueuePtrArg, uint8_t ar
 		errorCatcher(ec_sq_doesnt_exist_post);
 		return -1;
 	}
-	// check if spiqueue is full
-	if (structSpiQueuePtrArg->sizeCurrent >= structSpiQueuePtrArg->sizeMax) {
-		errorCatcher(ec_sq_full);
-		return -1;
-	}
 	// check if array length is correct
-	if (arraySizeArg != SQ_PACKET_SIZE) {
+	if (arraySizeArg != spiFormatActive->packetSize) {
 		errorCatcher(ec_sq_incorrect_array_length);
+		structSpiQueuePtrArg->metrics.drops[SQ_DROP_LENGTH]++;
 		return -1;
 	}
-	// appending first packet to spiqueue and increment packet count if spiqueuepacketappend succeeds
-	// head and tail point to same packet
-	if (structSpiQueuePtrArg->headPacketPtr == NULL) {
-		structSpiQueuePtrArg->headPacketPtr = spiQueuePacketAppend(arrayArg);
-		if (structSpiQueuePtrArg->headPacketPtr == NULL) {
-			// the failure to malloc a packet is already caught in spiqueuepacketappend
+	struct structPacket* packet = NULL;
+	// without a priority scheduler all packets share the normal class
+	uint8_t priority = SQ_PRIO_NORMAL;
+	if (structSpiQueuePtrArg->scheduler != SQ_SCHEDULER_FIFO) {
+		priority = spiQueueFindPriority(arrayArg[SQ_ID_INDEX]);
+	}
+	// in mailbox mode a pending packet with the same id is overwritten in place and keeps its turn
+	if (structSpiQueuePtrArg->mode == SQ_MODE_MAILBOX) {
+		packet = spiQueuePacketFind(&structSpiQueuePtrArg->classes[priority], arrayArg[SQ_ID_INDEX]);
+		if (packet != NULL) {
+			spiQueuePacketFill(packet, arrayArg);
+			structSpiQueuePtrArg->metrics.posts++;
+			structSpiQueuePtrArg->metrics.drops[SQ_DROP_OVERWRITE]++;
+		}
+	}
+	if (packet == NULL) {
+		// check if spiqueue is full, the overflow policy may make room
+		if (spiQueueMakeRoom(structSpiQueuePtrArg, 1, priority) != 0) {
 			return -1;
 		}
-		structSpiQueuePtrArg->sizeCurrent++;
-		structSpiQueuePtrArg->tailPacketPtr = structSpiQueuePtrArg->headPacketPtr;
-		// append packet into non empty spiqueue and increment packet count if spiqueuepacketappend succeeds
-		// append packet to to the tail and move tail pointer
-	} else {
-		structSpiQueuePtrArg->tailPacketPtr->nextPacketPtr = spiQueuePacketAppend(arrayArg);
-		if (structSpiQueuePtrArg->tailPacketPtr->nextPacketPtr == NULL) {
-			// the failure to malloc a packet is already caught in spiqueuepacketappend
+		packet = spiQueuePacketAppend(structSpiQueuePtrArg, arrayArg);
+		if (packet == NULL) {
+			// the exhaustion of the packet pool is already caught in spiqueuepacketappend
 			return -1;
 		}
-		structSpiQueuePtrArg->sizeCurrent++;
-		structSpiQueuePtrArg->tailPacketPtr = structSpiQueuePtrArg->tailPacketPtr->nextPacketPtr;
+		// append packet to the tail of its class
+		packet->priority = priority;
+		spiQueuePacketLink(structSpiQueuePtrArg, packet);
+		// select the packet to leave next, a higher class may overtake the current head
+		structSpiQueuePtrArg->headPacketPtr = spiQueueSelect(structSpiQueuePtrArg);
 	}
+	structSpiQueuePtrArg->tailPacketPtr = packet;
 	// check crc and set crcverified if crccheckarg
 	if (crcCheckArg) {
-		structSpiQueuePtrArg->tailPacketPtr->crc.verified = true;
-		if (structSpiQueuePtrArg->tailPacketPtr->crc.value.uint16 == GETCRC(arrayArg)) {
-			structSpiQueuePtrArg->tailPacketPtr->crc.good = true;
+		packet->crc.verified = true;
+		if (packet->crc.value.uint16 == GETCRC(arrayArg)) {
+			packet->crc.good = true;
 		}
 	}
 	return 0;
@@ -445,50 +966,37 @@ int8_t spiQueuePostArray(struct structSpiQueue* structSpiQueuePtrArg, uint8_t ar
 /**
  * @brief find the c datatype value in the lexicon for the specified id
  * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
- * @retval datatype enum
+ * @retval datatype enum, -1 for bad ids and ids without a lexicon entry
+ * @note - equipped with errorcatcher()
  */
 static int16_t spiQueueFindType(uint8_t identifierArg) {
-	// check if id is legal
-	if (identifierArg == 0x00 || identifierArg == 0xFF) {
+	// bad ids and ids without a lexicon row both read as x
+	if (lexicon[identifierArg].dataType == X) {
 		errorCatcher(ec_sq_bad_id);
 		return -1;
 	}
-	// find id array index
-	// index scope for loop and return
-	uint8_t index;
-	uint8_t lexiconHighestIndex = (sizeof(lexicon) / sizeof(lexicon[0])) - 1;
-	for (index = 0; index < lexiconHighestIndex; index++) {
-		if (lexicon[index].identifier == identifierArg) {
-			break;
-		}
-	}
-	// return the datatype for found index of id
-	return lexicon[index].dataType;
+	return lexicon[identifierArg].dataType;
 }
 
 /**
- * @brief create packet using id and integer value parameters
- * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
- * @param[in] identifierArg a predefined id recorded by the coder used to distinguish variables
+ * @brief encodes an integer value into the payload of a frame according to its datatype
+ * @param[out] payloadArg payload bytes of a frame or a record field, must be zero
+ * @param[in] dataTypeArg lexicon datatype of the id, as given by spiqueuefindtype()
  * @param[in] payloadValueArg integer value
  * @retval 0 on success, -1 on failure
  * @note - equipped with errorcatcher()
  */
-int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t identifierArg, int64_t payloadValueArg) {
-	// create temporary variables
-	uint8_t arrayTemp[SQ_PACKET_SIZE] = {0};
+static int8_t spiQueueEncodeInt(uint8_t payloadArg[], int16_t dataTypeArg, int64_t payloadValueArg) {
 	union unionPayload payloadTemp = {0};
-	// set id
-	arrayTemp[SQ_ID_INDEX] = identifierArg;
 	// switch case on datatype
-	switch (spiQueueFindType(identifierArg)) {
+	switch (dataTypeArg) {
 	case BINARY:
 		if (payloadValueArg != 0 && payloadValueArg != 1) {
 			errorCatcher(ec_sq_payload_out_of_range_binary);
 			return -1;
 		}
 		payloadTemp.binary = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 1);
+		memcpy(payloadArg, payloadTemp.uint8, 1);
 		break;
 	// for integer cases check if payloadvaluearg is within legal range
 	case UINT8:
@@ -497,7 +1005,7 @@ int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t iden
 			return -1;
 		}
 		payloadTemp.uint8[0] = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 1);
+		memcpy(payloadArg, payloadTemp.uint8, 1);
 		break;
 	case UINT16:
 		if (payloadValueArg < 0 || payloadValueArg > UINT16_MAX) {
@@ -505,7 +1013,7 @@ int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t iden
 			return -1;
 		}
 		payloadTemp.uint16 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 2);
+		memcpy(payloadArg, payloadTemp.uint8, 2);
 		break;
 	case UINT32:
 		if (payloadValueArg < 0 || payloadValueArg > UINT32_MAX) {
@@ -513,7 +1021,7 @@ int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t iden
 			return -1;
 		}
 		payloadTemp.uint32 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 4);
+		memcpy(payloadArg, payloadTemp.uint8, 4);
 		break;
 	case SINT8:
 		if (payloadValueArg < INT8_MIN || payloadValueArg > INT8_MAX) {
@@ -521,7 +1029,7 @@ int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t iden
 			return -1;
 		}
 		payloadTemp.sint8 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 1);
+		memcpy(payloadArg, payloadTemp.uint8, 1);
 		break;
 	case SINT16:
 		if (payloadValueArg < INT16_MIN || payloadValueArg > INT16_MAX) {
@@ -529,7 +1037,7 @@ int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t iden
 			return -1;
 		}
 		payloadTemp.sint16 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 2);
+		memcpy(payloadArg, payloadTemp.uint8, 2);
 		break;
 	case SINT32:
 		if (payloadValueArg < INT32_MIN || payloadValueArg > INT32_MAX) {
@@ -537,67 +1045,222 @@ int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t iden
 			return -1;
 		}
 		payloadTemp.sint32 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 4);
+		memcpy(payloadArg, payloadTemp.uint8, 4);
 		break;
 	// floating cases have no range checks
 	// natural numbers might also pass as floats
 	case FRAC32:
 		payloadTemp.frac32 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 4);
+		memcpy(payloadArg, payloadTemp.uint8, 4);
 		break;
 	case FRAC64:
 		payloadTemp.frac64 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 8);
+		memcpy(payloadArg, payloadTemp.uint8, 8);
 		break;
 	// when no datatype is found, which would be the most likely result of id being invalid
 	default:
 		errorCatcher(ec_sq_payload_no_datatype);
 		return -1;
 	}
-	// fill crc fields
-	union unionCrc crc;
-	crc.uint16 = GETCRC(arrayTemp);
-	memcpy(arrayTemp + SQ_CRC_INDEX, crc.uint8, SQ_CRC_SIZE);
-	// create packet from arraytemp
-	spiQueuePostArray(structSpiQueuePtrArg, arrayTemp, arraysize(arrayTemp), false);
 	return 0;
 }
 
 /**
- * @brief create packet using id and fractional value parameters
- * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
- * @param[in] identifierArg a predefined id recorded by the coder used to distinguish variables
+ * @brief encodes a fractional value into the payload of a frame according to its datatype
+ * @param[out] payloadArg payload bytes of a frame or a record field, must be zero
+ * @param[in] dataTypeArg lexicon datatype of the id, as given by spiqueuefindtype()
  * @param[in] payloadValueArg fractional value
  * @retval 0 on success, -1 on failure
  * @note - equipped with errorcatcher()
  */
-int8_t spiQueuePostFrac(struct structSpiQueue* structSpiQueuePtrArg, uint8_t identifierArg, double payloadValueArg) {
-	// create temporary variables
-	uint8_t arrayTemp[SQ_PACKET_SIZE] = {0};
+static int8_t spiQueueEncodeFrac(uint8_t payloadArg[], int16_t dataTypeArg, double payloadValueArg) {
 	union unionPayload payloadTemp = {0};
-	// set id
-	arrayTemp[SQ_ID_INDEX] = identifierArg;
 	// switch case on datatype
-	switch (spiQueueFindType(identifierArg)) {
+	switch (dataTypeArg) {
 	case FRAC32:
 		payloadTemp.frac32 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 4);
+		memcpy(payloadArg, payloadTemp.uint8, 4);
 		break;
 	case FRAC64:
 		payloadTemp.frac64 = payloadValueArg;
-		memcpy(arrayTemp + SQ_PAYLOAD_INDEX, payloadTemp.uint8, 8);
+		memcpy(payloadArg, payloadTemp.uint8, 8);
 		break;
 	// when no datatype is found, which would be the most likely result of id being invalid
 	default:
 		errorCatcher(ec_sq_payload_no_datatype);
 		return -1;
 	}
+	return 0;
+}
+
+/**
+ * @brief encodes a value handed as double into the payload of a frame according to its datatype
+ * @param[out] payloadArg payload bytes of a frame or a record field, must be zero
+ * @param[in] dataTypeArg lexicon datatype of the id, as given by spiqueuefindtype()
+ * @param[in] payloadValueArg value, truncated for integer datatypes
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ */
+static int8_t spiQueueEncodeValue(uint8_t payloadArg[], int16_t dataTypeArg, double payloadValueArg) {
+	if (dataTypeArg == FRAC32 || dataTypeArg == FRAC64) {
+		return spiQueueEncodeFrac(payloadArg, dataTypeArg, payloadValueArg);
+	}
+	// clamp before the cast, the range check of the datatype rejects the clamped value
+	return spiQueueEncodeInt(payloadArg, dataTypeArg, payloadValueArg >= 4e18 ? INT64_MAX : payloadValueArg <= -4e18 ? INT64_MIN : (int64_t)payloadValueArg);
+}
+
+/**
+ * @brief create packet using id and integer value parameters
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] identifierArg a predefined id recorded by the coder used to distinguish variables
+ * @param[in] payloadValueArg integer value
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ */
+int8_t spiQueuePostInt(struct structSpiQueue* structSpiQueuePtrArg, uint8_t identifierArg, int64_t payloadValueArg) {
+	// create temporary frame and set id
+	uint8_t arrayTemp[SQ_SLOT_SIZE] = {0};
+	arrayTemp[SQ_ID_INDEX] = identifierArg;
+	if (spiQueueEncodeInt(arrayTemp + spiFormatActive->payloadIndex, spiQueueFindType(identifierArg), payloadValueArg) != 0) {
+		if (structSpiQueuePtrArg != NULL) {
+			structSpiQueuePtrArg->metrics.drops[SQ_DROP_ENCODE]++;
+		}
+		return -1;
+	}
 	// fill crc fields
 	union unionCrc crc;
 	crc.uint16 = GETCRC(arrayTemp);
-	memcpy(arrayTemp + SQ_CRC_INDEX, crc.uint8, SQ_CRC_SIZE);
+	memcpy(arrayTemp + spiFormatActive->crcIndex, crc.uint8, SQ_CRC_SIZE);
 	// create packet from arraytemp
-	spiQueuePostArray(structSpiQueuePtrArg, arrayTemp, arraysize(arrayTemp), false);
+	return spiQueuePostArray(structSpiQueuePtrArg, arrayTemp, spiFormatActive->packetSize, false);
+}
+
+/**
+ * @brief create packet using id and fractional value parameters
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] identifierArg a predefined id recorded by the coder used to distinguish variables
+ * @param[in] payloadValueArg fractional value
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ */
+int8_t spiQueuePostFrac(struct structSpiQueue* structSpiQueuePtrArg, uint8_t identifierArg, double payloadValueArg) {
+	// create temporary frame and set id
+	uint8_t arrayTemp[SQ_SLOT_SIZE] = {0};
+	arrayTemp[SQ_ID_INDEX] = identifierArg;
+	if (spiQueueEncodeFrac(arrayTemp + spiFormatActive->payloadIndex, spiQueueFindType(identifierArg), payloadValueArg) != 0) {
+		if (structSpiQueuePtrArg != NULL) {
+			structSpiQueuePtrArg->metrics.drops[SQ_DROP_ENCODE]++;
+		}
+		return -1;
+	}
+	// fill crc fields
+	union unionCrc crc;
+	crc.uint16 = GETCRC(arrayTemp);
+	memcpy(arrayTemp + spiFormatActive->crcIndex, crc.uint8, SQ_CRC_SIZE);
+	// create packet from arraytemp
+	return spiQueuePostArray(structSpiQueuePtrArg, arrayTemp, spiFormatActive->packetSize, false);
+}
+
+/**
+ * @brief counts the packets a batch adds to the spiqueue
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] identifierArg array of predefined ids recorded by the lexicon
+ * @param[in] priorityArg array of the priority classes the ids are queued in
+ * @param[in] countArg number of ids
+ * @retval number of ids that need a packet of their own
+ * @note - in mailbox mode an id that is pending, or comes earlier in the batch, overwrites a packet and needs none
+ */
+static uint8_t spiQueueBatchRoom(struct structSpiQueue* structSpiQueuePtrArg, const uint8_t identifierArg[], const uint8_t priorityArg[], uint8_t countArg) {
+	if (structSpiQueuePtrArg->mode != SQ_MODE_MAILBOX) {
+		return countArg;
+	}
+	uint8_t room = 0;
+	for (uint8_t index = 0; index < countArg; index++) {
+		bool overwrites = spiQueuePacketFind(&structSpiQueuePtrArg->classes[priorityArg[index]], identifierArg[index]) != NULL;
+		for (uint8_t earlier = 0; earlier < index && !overwrites; earlier++) {
+			overwrites = identifierArg[earlier] == identifierArg[index];
+		}
+		if (!overwrites) {
+			room++;
+		}
+	}
+	return room;
+}
+
+/**
+ * @brief create packets for multiple ids and values in one go
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] identifierArg array of predefined ids recorded by the lexicon
+ * @param[in] payloadValueArg array of values, truncated for integer datatypes
+ * @param[in] countArg number of ids and values
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - all or nothing, every frame is encoded before the spiqueue is touched and a batch without room changes nothing
+ * @note - in mailbox mode ids that overwrite a pending packet need no room, like in spiqueuepostarray()
+ * @note - the frames are encoded on the stack, countarg * sq_slot_size bytes
+ */
+int8_t spiQueuePostMany(struct structSpiQueue* structSpiQueuePtrArg, const uint8_t identifierArg[], const double payloadValueArg[], uint8_t countArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist_post);
+		return -1;
+	}
+	if (countArg == 0) {
+		return 0;
+	}
+	// encode every frame once, crc included, before anything changes
+	uint8_t frames[countArg][SQ_SLOT_SIZE];
+	uint8_t priorities[countArg];
+	// older packets are only dropped for the lowest class in the batch
+	uint8_t priority = SQ_PRIO_NORMAL;
+	if (structSpiQueuePtrArg->scheduler != SQ_SCHEDULER_FIFO) {
+		priority = SQ_PRIO_HIGH;
+	}
+	for (uint8_t index = 0; index < countArg; index++) {
+		memset(frames[index], 0, SQ_SLOT_SIZE);
+		frames[index][SQ_ID_INDEX] = identifierArg[index];
+		if (spiQueueEncodeValue(frames[index] + spiFormatActive->payloadIndex, spiQueueFindType(identifierArg[index]), payloadValueArg[index]) != 0) {
+			structSpiQueuePtrArg->metrics.drops[SQ_DROP_ENCODE] += countArg;
+			return -1;
+		}
+		union unionCrc crc;
+		crc.uint16 = GETCRC(frames[index]);
+		memcpy(frames[index] + spiFormatActive->crcIndex, crc.uint8, SQ_CRC_SIZE);
+		priorities[index] = SQ_PRIO_NORMAL;
+		if (structSpiQueuePtrArg->scheduler != SQ_SCHEDULER_FIFO) {
+			priorities[index] = spiQueueFindPriority(identifierArg[index]);
+		}
+		if (priorities[index] > priority) {
+			priority = priorities[index];
+		}
+	}
+	// reserve room for the new packets of the batch, an evicted packet the batch would have overwritten needs room again
+	uint8_t room = spiQueueBatchRoom(structSpiQueuePtrArg, identifierArg, priorities, countArg);
+	do {
+		if (spiQueueMakeRoom(structSpiQueuePtrArg, room, priority) != 0) {
+			return -1;
+		}
+		room = spiQueueBatchRoom(structSpiQueuePtrArg, identifierArg, priorities, countArg);
+	} while (room > structSpiQueuePtrArg->sizeMax - structSpiQueuePtrArg->sizeCurrent);
+	// publish, every new packet has its room
+	for (uint8_t index = 0; index < countArg; index++) {
+		struct structPacket* packet = NULL;
+		if (structSpiQueuePtrArg->mode == SQ_MODE_MAILBOX) {
+			packet = spiQueuePacketFind(&structSpiQueuePtrArg->classes[priorities[index]], identifierArg[index]);
+		}
+		if (packet != NULL) {
+			// overwrite the pending packet in place, it keeps its turn
+			spiQueuePacketFill(packet, frames[index]);
+			structSpiQueuePtrArg->metrics.posts++;
+			structSpiQueuePtrArg->metrics.drops[SQ_DROP_OVERWRITE]++;
+		} else {
+			packet = spiQueuePacketAppend(structSpiQueuePtrArg, frames[index]);
+			packet->priority = priorities[index];
+			spiQueuePacketLink(structSpiQueuePtrArg, packet);
+		}
+		structSpiQueuePtrArg->tailPacketPtr = packet;
+	}
+	structSpiQueuePtrArg->headPacketPtr = spiQueueSelect(structSpiQueuePtrArg);
 	return 0;
 }
 
@@ -617,58 +1280,1347 @@ int8_t spiQueueGetArray(struct structSpiQueue* structSpiQueuePtrArg, uint8_t arr
 		spiQueuePostInt(structSpiQueuePtrArg, ID_FILLER, 0x00);
 	}
 	// check if array length is correct
-	if (arraySizeArg != SQ_PACKET_SIZE) {
+	if (arraySizeArg != spiFormatActive->packetSize) {
 		errorCatcher(ec_sq_incorrect_array_length);
 		return -1;
 	}
-	// get id
-	memcpy(arrayArg + SQ_ID_INDEX, &(structSpiQueuePtrArg->headPacketPtr->identifier), SQ_ID_SIZE);
-	// get payload
-	memcpy(arrayArg + SQ_PAYLOAD_INDEX, structSpiQueuePtrArg->headPacketPtr->payload.uint8, SQ_PAYLOAD_SIZE);
-	// get ack
-	memcpy(arrayArg + SQ_ACK_INDEX, structSpiQueuePtrArg->headPacketPtr->ack.returnCrc.uint8, SQ_ACK_SIZE);
-	// get crc
-	memcpy(arrayArg + SQ_CRC_INDEX, structSpiQueuePtrArg->headPacketPtr->crc.value.uint8, SQ_CRC_SIZE);
+	spiQueuePacketToArray(structSpiQueuePtrArg->headPacketPtr, arrayArg);
+	return 0;
+}
+
+/**
+ * @brief moves up to maxframesarg frames from the head of the spiqueue into one contiguous array
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[out] arrayArg[] pointer to array of maxframesarg frames of the active format
+ * @param[in] maxFramesArg maximum number of frames to move
+ * @retval number of frames moved, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - frames leave in scheduler order and are removed from the spiqueue, an empty spiqueue gives 0 frames
+ */
+int16_t spiQueueGetBurst(struct structSpiQueue* structSpiQueuePtrArg, uint8_t arrayArg[], uint8_t maxFramesArg) {
+	// check if spiqueue exists
+	if (structSpiQueuePtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	uint8_t frames = 0;
+	while (frames < maxFramesArg && structSpiQueuePtrArg->headPacketPtr != NULL) {
+		spiQueuePacketToArray(structSpiQueuePtrArg->headPacketPtr, arrayArg + frames * spiFormatActive->packetSize);
+		spiQueuePacketRemove(structSpiQueuePtrArg);
+		frames++;
+	}
+	return frames;
+}
+
+// SPIRING ------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief allocates memory and initialises a spiring according to the structspiring layout
+ * @param[in] structSpiRingPtrArg double pointer to the spiring pointer
+ * @param[in] sizeMaxArg amount of slots, must be a power of two
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorCatcher()
+ * @note - not isr safe, create the spiring during init
+ */
+int8_t spiRingCreate(struct structSpiRing** structSpiRingPtrArg, uint16_t sizeMaxArg) {
+	// check if spiring already exists
+	if (*structSpiRingPtrArg != NULL) {
+		errorCatcher(ec_sq_already_exist);
+		return -1;
+	}
+	// check if size is a power of two
+	if (sizeMaxArg == 0 || (sizeMaxArg & (sizeMaxArg - 1)) != 0) {
+		errorCatcher(ec_sq_ring_size_bad);
+		return -1;
+	}
+	// malloc new spiring with its slots directly behind it
+	struct structSpiRing* newStructSpiRing = malloc(sizeof(struct structSpiRing) + sizeMaxArg * sizeof(struct structSpiRingSlot));
+	// check if malloc was successful
+	if (newStructSpiRing == NULL) {
+		errorCatcher(ec_sq_malloc_failed);
+		return -1;
+	}
+	// initialize spiring default fields
+	newStructSpiRing->mask = sizeMaxArg - 1;
+	newStructSpiRing->head = 0;
+	newStructSpiRing->tail = 0;
+	newStructSpiRing->dropCount = 0;
+	newStructSpiRing->slotPtr = (struct structSpiRingSlot*)(newStructSpiRing + 1);
+	// every slot starts free for the producer claiming its position
+	for (uint16_t index = 0; index < sizeMaxArg; index++) {
+		newStructSpiRing->slotPtr[index].sequence = index;
+	}
+	// set address of malloced spiring to argument pointer
+	*structSpiRingPtrArg = newStructSpiRing;
+	return 0;
+}
+
+/**
+ * @brief removes the spiring and all its slots
+ * @param[in] structSpiRingPtrArg double pointer to the spiring pointer
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ */
+int8_t spiRingRemove(struct structSpiRing** structSpiRingPtrArg) {
+	// check if ptr is not zero
+	if (*structSpiRingPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	// free spiring, the slots live in the same allocation
+	free(*structSpiRingPtrArg);
+	// zero the address
+	*structSpiRingPtrArg = NULL;
 	return 0;
 }
 
 /**
- * @brief placeholder
+ * @brief claims the slot at the spiring tail so a producer or dma can write a frame straight into it
+ * @param[in] structSpiRingPtrArg pointer to the structspiring instance
+ * @retval pointer to the word aligned frame of the claimed slot, null when the spiring is full
+ * @note - may be called by multiple producers including isrs, every claimed slot must be handed to spiringcommit()
+ * @note - not equipped with errorcatcher() to stay isr safe, a full spiring increments dropcount
  */
-int8_t spiQueueProcessAck(struct structSpiQueue* spiQueueTransmitPtrArg, struct structSpiQueue* spiQueueReceivePtrArg, bool ignoreAck) {
-	if (ignoreAck) {
-		if (spiQueueTransmitPtrArg->sizeCurrent > 0) {
-			spiQueuePacketRemove(spiQueueTransmitPtrArg);
+uint8_t* spiRingReserve(struct structSpiRing* structSpiRingPtrArg) {
+	struct structSpiRingSlot* slot;
+	uint32_t position = __atomic_load_n(&structSpiRingPtrArg->tail, __ATOMIC_RELAXED);
+	// claim a slot by moving the tail, retry when another producer claimed it first
+	for (;;) {
+		slot = &structSpiRingPtrArg->slotPtr[position & structSpiRingPtrArg->mask];
+		int32_t difference = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - position);
+		if (difference == 0) {
+			// a failed exchange reloads position with the current tail
+			if (__atomic_compare_exchange_n(&structSpiRingPtrArg->tail, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				return slot->frame;
+			}
+		} else if (difference < 0) {
+			// slot still holds a frame from the previous lap, the spiring is full
+			__atomic_fetch_add(&structSpiRingPtrArg->dropCount, 1, __ATOMIC_RELAXED);
+			return NULL;
+		} else {
+			position = __atomic_load_n(&structSpiRingPtrArg->tail, __ATOMIC_RELAXED);
 		}
-	} else {
-		errorCatcher(ec_sq_not_implemented);
+	}
+}
+
+/**
+ * @brief publishes a slot claimed with spiringreserve() to the consumer
+ * @param[in] frameArg frame pointer returned by spiringreserve()
+ * @note - isr safe
+ */
+void spiRingCommit(uint8_t frameArg[]) {
+	struct structSpiRingSlot* slot = (struct structSpiRingSlot*)(frameArg - offsetof(struct structSpiRingSlot, frame));
+	// until published the sequence still holds the claimed position, only this producer touches it
+	__atomic_store_n(&slot->sequence, slot->sequence + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief appends a frame to the spiring tail, may be called by multiple producers including isrs
+ * @param[in] structSpiRingPtrArg pointer to the structspiring instance
+ * @param[in] arrayArg frame in wire layout
+ * @param[in] arraySizeArg size of arrayarg
+ * @retval 0 on success, -1 on failure
+ * @note - not equipped with errorcatcher() to stay isr safe, a full spiring increments dropcount
+ */
+int8_t spiRingPostArray(struct structSpiRing* structSpiRingPtrArg, uint8_t arrayArg[], uint8_t arraySizeArg) {
+	// check if spiring exists and array length is correct
+	if (structSpiRingPtrArg == NULL || arraySizeArg != spiFormatActive->packetSize) {
+		return -1;
+	}
+	uint8_t* frame = spiRingReserve(structSpiRingPtrArg);
+	if (frame == NULL) {
+		return -1;
+	}
+	// fill slot and publish it to the consumer
+	memcpy(frame, arrayArg, arraySizeArg);
+	spiRingCommit(frame);
+	return 0;
+}
+
+/**
+ * @brief gives access to the frame at the spiring head without copying it, may only be called by a single consumer
+ * @param[in] structSpiRingPtrArg pointer to the structspiring instance
+ * @retval pointer to the word aligned head frame, null when empty
+ * @note - the frame stays valid until spiringrelease()
+ */
+uint8_t* spiRingPeek(struct structSpiRing* structSpiRingPtrArg) {
+	uint32_t position = structSpiRingPtrArg->head;
+	struct structSpiRingSlot* slot = &structSpiRingPtrArg->slotPtr[position & structSpiRingPtrArg->mask];
+	// check if the producer of this position already published its frame
+	if ((int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - (position + 1)) < 0) {
+		return NULL;
+	}
+	return slot->frame;
+}
+
+/**
+ * @brief hands the head slot back to the producers, may only be called by a single consumer
+ * @param[in] structSpiRingPtrArg pointer to the structspiring instance
+ * @retval 0 on success, -1 when empty
+ */
+int8_t spiRingRelease(struct structSpiRing* structSpiRingPtrArg) {
+	uint32_t position = structSpiRingPtrArg->head;
+	struct structSpiRingSlot* slot = &structSpiRingPtrArg->slotPtr[position & structSpiRingPtrArg->mask];
+	if ((int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - (position + 1)) < 0) {
 		return -1;
 	}
+	// the slot becomes claimable again one lap later
+	__atomic_store_n(&slot->sequence, position + structSpiRingPtrArg->mask + 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&structSpiRingPtrArg->head, position + 1, __ATOMIC_RELAXED);
 	return 0;
 }
 
 /**
- * @brief checks if the input array has changed
- * @param[out] duplicateArg true if changed, false is the same
- * @param[in] arrayArg[] pointer to input array
+ * @brief takes the frame from the spiring head, may only be called by a single consumer
+ * @param[in] structSpiRingPtrArg pointer to the structspiring instance
+ * @param[out] arrayArg[] pointer to array to retrieve the frame to
  * @param[in] arraySizeArg size of arrayarg
+ * @retval 0 on success, -1 on failure or when empty
+ * @note - not equipped with errorcatcher(), an empty spiring is not an error
+ */
+int8_t spiRingGetArray(struct structSpiRing* structSpiRingPtrArg, uint8_t arrayArg[], uint8_t arraySizeArg) {
+	// check if spiring exists and array length is correct
+	if (structSpiRingPtrArg == NULL || arraySizeArg != spiFormatActive->packetSize) {
+		return -1;
+	}
+	uint8_t* frame = spiRingPeek(structSpiRingPtrArg);
+	if (frame == NULL) {
+		return -1;
+	}
+	memcpy(arrayArg, frame, arraySizeArg);
+	return spiRingRelease(structSpiRingPtrArg);
+}
+
+/**
+ * @brief number of frames claimed but not yet taken by the consumer
+ * @param[in] structSpiRingPtrArg pointer to the structspiring instance
+ * @retval amount of frames
+ */
+uint32_t spiRingSizeCurrent(struct structSpiRing* structSpiRingPtrArg) {
+	return __atomic_load_n(&structSpiRingPtrArg->tail, __ATOMIC_RELAXED) - __atomic_load_n(&structSpiRingPtrArg->head, __ATOMIC_RELAXED);
+}
+
+// SPISTREAM ----------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief allocates memory and initialises a spistream according to the structspistream layout
+ * @param[in] structSpiStreamPtrArg double pointer to the spistream pointer
+ * @param[in] framesHalfArg frames per half of the double buffer
  * @retval 0 on success, -1 on failure
  * @note - equipped with errorcatcher()
+ * @note - both transmit halves start out as filler frames, the dma may be started right away
+ * @note - the halves are laid out in the frame format active at creation, negotiate the format first
  */
-int8_t spiQueueNoDuplicate(bool* duplicateArg, uint8_t arrayArg[], uint8_t arraySizeArg) {
-	// check if array length is correct
-	if (arraySizeArg != SQ_PACKET_SIZE) {
-		errorCatcher(ec_sq_incorrect_array_length);
+int8_t spiStreamCreate(struct structSpiStream** structSpiStreamPtrArg, uint8_t framesHalfArg) {
+	// check if spistream already exists
+	if (*structSpiStreamPtrArg != NULL) {
+		errorCatcher(ec_sq_already_exist);
 		return -1;
 	}
-	// persistent array to hold previous value
-	static uint8_t memoryArray[SQ_PACKET_SIZE] = {0};
-	if (memcmp(memoryArray, arrayArg, SQ_PACKET_SIZE) == 0) {
-		// they are the same therefore duplicate=true -> NO!_duplicate=false
-		*duplicateArg = false;
-	} else {
-		*duplicateArg = true;
-		memcpy(memoryArray, arrayArg, SQ_PACKET_SIZE);
+	// check if a half holds at least one frame
+	if (framesHalfArg == 0) {
+		errorCatcher(ec_sq_stream_size_bad);
+		return -1;
+	}
+	uint32_t halfSize = (uint32_t)framesHalfArg * spiFormatActive->packetSize;
+	// the receive halves start on a word boundary behind the transmit halves
+	uint32_t transmitSize = (2 * halfSize + sizeof(uint32_t) - 1) & ~(uint32_t)(sizeof(uint32_t) - 1);
+	// malloc new spistream with both double buffers directly behind it
+	struct structSpiStream* newStructSpiStream = malloc(sizeof(struct structSpiStream) + transmitSize + 2 * halfSize);
+	// check if malloc was successful
+	if (newStructSpiStream == NULL) {
+		errorCatcher(ec_sq_malloc_failed);
+		return -1;
+	}
+	// initialize spistream default fields
+	newStructSpiStream->framesHalf = framesHalfArg;
+	newStructSpiStream->packetSize = spiFormatActive->packetSize;
+	newStructSpiStream->halfSize = halfSize;
+	newStructSpiStream->completed = 0;
+	newStructSpiStream->consumed = 0;
+	newStructSpiStream->overrunCount = 0;
+	newStructSpiStream->transmitPtr = (uint8_t*)(newStructSpiStream + 1);
+	newStructSpiStream->receivePtr = newStructSpiStream->transmitPtr + transmitSize;
+	memset(newStructSpiStream->receivePtr, 0, 2 * halfSize);
+	// filler frame with a valid crc, the same frame spiqueuegetarray() sends from an empty spiqueue
+	union unionCrc crc;
+	memset(newStructSpiStream->filler, 0, SQ_SLOT_SIZE);
+	newStructSpiStream->filler[SQ_ID_INDEX] = ID_FILLER;
+	crc.uint16 = GETCRC(newStructSpiStream->filler);
+	memcpy(newStructSpiStream->filler + spiFormatActive->crcIndex, crc.uint8, SQ_CRC_SIZE);
+	spiStreamFill(newStructSpiStream, newStructSpiStream->transmitPtr, NULL);
+	spiStreamFill(newStructSpiStream, newStructSpiStream->transmitPtr + halfSize, NULL);
+	// set address of malloced spistream to argument pointer
+	*structSpiStreamPtrArg = newStructSpiStream;
+	return 0;
+}
+
+/**
+ * @brief removes the spistream and both double buffers
+ * @param[in] structSpiStreamPtrArg double pointer to the spistream pointer
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - stop the dma first, it runs over the double buffers until it is aborted
+ */
+int8_t spiStreamRemove(struct structSpiStream** structSpiStreamPtrArg) {
+	// check if ptr is not zero
+	if (*structSpiStreamPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	// free spistream, the double buffers live in the same allocation
+	free(*structSpiStreamPtrArg);
+	// zero the address
+	*structSpiStreamPtrArg = NULL;
+	return 0;
+}
+
+/**
+ * @brief marks a half as finished by the dma, called from the half and complete callbacks
+ * @param[in] structSpiStreamPtrArg pointer to the structspistream instance
+ * @param[in] halfArg 0 from the half transfer callback, 1 from the transfer complete callback
+ * @note - not equipped with errorcatcher() to stay isr safe
+ * @note - a missed callback is caught up, the half it stood for counts as an overrun in spistreamtake()
+ */
+void spiStreamHalfDone(struct structSpiStream* structSpiStreamPtrArg, uint8_t halfArg) {
+	uint32_t completed = structSpiStreamPtrArg->completed;
+	if ((completed & 1) != (halfArg & 1)) {
+		completed++;
+	}
+	__atomic_store_n(&structSpiStreamPtrArg->completed, completed + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief gives the consumer the oldest finished half that the dma has not started over yet
+ * @param[in] structSpiStreamPtrArg pointer to the structspistream instance
+ * @param[out] transmitArg transmit half to refill, sent once the dma wraps around to it
+ * @retval receive half holding frameshalf frames in wire layout, null when no half is finished
+ * @note - the half stays with the consumer until spistreamgive(), which has to happen within one half transfer
+ * @note - halves the consumer fell behind on are skipped and counted in overruncount
+ */
+uint8_t* spiStreamTake(struct structSpiStream* structSpiStreamPtrArg, uint8_t** transmitArg) {
+	uint32_t completed = __atomic_load_n(&structSpiStreamPtrArg->completed, __ATOMIC_ACQUIRE);
+	uint32_t pending = completed - structSpiStreamPtrArg->consumed;
+	if (pending == 0) {
+		return NULL;
+	}
+	// the dma already runs over every half but the newest finished one
+	if (pending > 1) {
+		structSpiStreamPtrArg->overrunCount += pending - 1;
+		structSpiStreamPtrArg->consumed = completed - 1;
+	}
+	uint32_t offset = (structSpiStreamPtrArg->consumed & 1) * structSpiStreamPtrArg->halfSize;
+	*transmitArg = structSpiStreamPtrArg->transmitPtr + offset;
+	return structSpiStreamPtrArg->receivePtr + offset;
+}
+
+/**
+ * @brief fills a transmit half with frames from the spiqueue and pads the rest with filler frames
+ * @param[in] structSpiStreamPtrArg pointer to the structspistream instance
+ * @param[out] transmitArg transmit half returned by spistreamtake()
+ * @param[in] structSpiQueuePtrArg spiqueue to drain, null for filler frames only
+ * @retval number of frames taken from the spiqueue, -1 on failure
+ */
+int16_t spiStreamFill(struct structSpiStream* structSpiStreamPtrArg, uint8_t transmitArg[], struct structSpiQueue* structSpiQueuePtrArg) {
+	int16_t frames = 0;
+	if (structSpiQueuePtrArg != NULL) {
+		frames = spiQueueGetBurst(structSpiQueuePtrArg, transmitArg, structSpiStreamPtrArg->framesHalf);
+		if (frames < 0) {
+			return -1;
+		}
+	}
+	for (uint8_t index = frames; index < structSpiStreamPtrArg->framesHalf; index++) {
+		memcpy(transmitArg + index * structSpiStreamPtrArg->packetSize, structSpiStreamPtrArg->filler, structSpiStreamPtrArg->packetSize);
+	}
+	return frames;
+}
+
+/**
+ * @brief hands the half taken with spistreamtake() back to the dma
+ * @param[in] structSpiStreamPtrArg pointer to the structspistream instance
+ * @retval 0 when given back in time, -1 when the dma already started over the half
+ * @note - a late half may have been sent before it was refilled, it counts in overruncount
+ */
+int8_t spiStreamGive(struct structSpiStream* structSpiStreamPtrArg) {
+	uint32_t completed = __atomic_load_n(&structSpiStreamPtrArg->completed, __ATOMIC_ACQUIRE);
+	uint32_t consumed = structSpiStreamPtrArg->consumed;
+	if (completed == consumed) {
+		return -1;
+	}
+	__atomic_store_n(&structSpiStreamPtrArg->consumed, consumed + 1, __ATOMIC_RELEASE);
+	// the half after this one finished as well, so the dma is back on this half
+	if (completed - consumed > 1) {
+		structSpiStreamPtrArg->overrunCount++;
+		return -1;
 	}
 	return 0;
 }
+
+// SPIFORMAT ----------------------------------------------------------------------------------------------------------------
+
+/** @brief field layout of every format version, indexed by the version */
+static const struct structSpiFormat spiFormats[SQ_FORMAT_LATEST + 1] = {
+	[SQ_FORMAT_V1] = {SQ_FORMAT_V1, SQ_PACKET_SIZE, SQ_FRAME_SIZE, SQ_ID_INDEX, 0, SQ_PAYLOAD_INDEX, SQ_ACK_INDEX, SQ_CRC_INDEX},
+	[SQ_FORMAT_V2] = {SQ_FORMAT_V2, SQ_V2_PACKET_SIZE, SQ_V2_FRAME_SIZE, SQ_V2_SEQUENCE_INDEX, SQ_V2_SEQUENCE_SIZE, SQ_V2_PAYLOAD_INDEX, SQ_V2_ACK_INDEX, SQ_V2_CRC_INDEX},
+};
+
+/** @brief format of every frame encoded and decoded, every link starts out in v1 */
+const struct structSpiFormat* spiFormatActive = &spiFormats[SQ_FORMAT_V1];
+
+/**
+ * @brief selects the frame format of all following encodes and decodes
+ * @param[in] versionArg version from spiformatversions
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - switch while the spiqueues and spirings are empty, pending packets keep the crc of the old layout
+ */
+int8_t spiFormatSet(uint8_t versionArg) {
+	// check if the version is known
+	if (versionArg < SQ_FORMAT_V1 || versionArg > SQ_FORMAT_LATEST) {
+		errorCatcher(ec_sq_format_bad);
+		return -1;
+	}
+	spiFormatActive = &spiFormats[versionArg];
+	return 0;
+}
+
+/**
+ * @brief builds the frame offering the highest supported format version to the other side of the link
+ * @param[out] arrayArg frame of sq_packet_size bytes, always in the v1 layout both sides start out in
+ * @param[in] versionArg highest version this side supports
+ * @param[in] agreedArg version agreed from the last intact offer of the other side, 0 before one arrived
+ * @note - both sides send an offer and answer the offer they receive with spiformatanswer(), the agreed version
+ * travels back in the next offer so the other side knows its offer arrived
+ */
+void spiFormatOffer(uint8_t arrayArg[], uint8_t versionArg, uint8_t agreedArg) {
+	union unionCrc crc;
+	memset(arrayArg, 0, SQ_PACKET_SIZE);
+	arrayArg[SQ_ID_INDEX] = ID_FORMAT;
+	arrayArg[SQ_PAYLOAD_INDEX] = versionArg;
+	arrayArg[SQ_PAYLOAD_INDEX + 1] = agreedArg;
+	crc.uint16 = GETCRCSIZE(arrayArg, SQ_FRAME_SIZE);
+	memcpy(arrayArg + SQ_CRC_INDEX, crc.uint8, SQ_CRC_SIZE);
+}
+
+/**
+ * @brief selects the highest version both sides support from the offer of the other side
+ * @param[in] frameArg frame received in the v1 layout
+ * @param[in] versionArg highest version this side supports
+ * @param[out] agreedArg version both sides support, to send back with the next spiformatoffer()
+ * @retval agreed version once the other side sent it back, 0 while it did not, -1 when the frame is not an intact offer
+ * @note - equipped with errorcatcher()
+ * @note - the active format is left as it is, switch with spiformatset() once the agreed version came back,
+ * both sides of a full duplex link see that in the same transaction and switch before the next one
+ */
+int8_t spiFormatAnswer(uint8_t frameArg[], uint8_t versionArg, uint8_t* agreedArg) {
+	union unionCrc crc;
+	memcpy(crc.uint8, frameArg + SQ_CRC_INDEX, SQ_CRC_SIZE);
+	if (frameArg[SQ_ID_INDEX] != ID_FORMAT || crc.uint16 != (uint16_t)GETCRCSIZE(frameArg, SQ_FRAME_SIZE)) {
+		return -1;
+	}
+	uint8_t agreed = frameArg[SQ_PAYLOAD_INDEX] < versionArg ? frameArg[SQ_PAYLOAD_INDEX] : versionArg;
+	// check if the version is known
+	if (agreed < SQ_FORMAT_V1 || agreed > SQ_FORMAT_LATEST) {
+		errorCatcher(ec_sq_format_bad);
+		return -1;
+	}
+	*agreedArg = agreed;
+	return frameArg[SQ_PAYLOAD_INDEX + 1] == agreed ? agreed : 0;
+}
+
+// SPIRECORD ----------------------------------------------------------------------------------------------------------------
+
+/** @brief structure definition for a record layout */
+struct structSpiRecord {
+	uint8_t identifier;		   /**< lexicon id of datatype record */
+	uint8_t version;		   /**< layout version, a receiver rejects records of another version */
+	uint8_t fieldCount;		   /**< number of fields */
+	const uint8_t* fieldIdPtr; /**< lexicon ids of the fields in wire order */
+};
+
+/** @brief turns a field of a record row into its lexicon id */
+#define SQ_RECORDS_FIELD(NAME) NAME,
+/** @brief turns a record row into the array of its field ids */
+#define SQ_RECORDS_FIELDS(NAME, VERSION, FIELDS) static const uint8_t spiRecordFields_##NAME[] = {FIELDS(SQ_RECORDS_FIELD)};
+/** @brief turns a record row into the record layout at its record index */
+#define SQ_RECORDS_ENTRY(NAME, VERSION, FIELDS) [NAME##_INDEX] = {NAME, VERSION, arraysize(spiRecordFields_##NAME), spiRecordFields_##NAME},
+
+SQ_RECORDS(SQ_RECORDS_FIELDS)
+
+/** @brief record layouts, indexed by record index */
+static const struct structSpiRecord spiRecords[SQ_RECORDS_COUNT] = {SQ_RECORDS(SQ_RECORDS_ENTRY)};
+
+/**
+ * @brief find the record index for the specified id
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @retval record index, -1 for ids of another datatype than record
+ */
+static int16_t spiRecordFind(uint8_t identifierArg) {
+	if (lexicon[identifierArg].dataType != RECORD) {
+		return -1;
+	}
+	for (uint8_t index = 0; index < SQ_RECORDS_COUNT; index++) {
+		if (spiRecords[index].identifier == identifierArg) {
+			return index;
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief places the fields of a record
+ * @param[in] recordArg record layout
+ * @param[out] offsetArg room for sq_record_fields_max byte indexes, one per field
+ * @retval byte index of the crc, which covers everything in front of it, 0 when the record declares too many fields
+ * @note - a field is aligned to its size up to a word, so the dma and the crc unit see whole words in v2
+ */
+static uint8_t spiRecordLayout(const struct structSpiRecord* recordArg, uint8_t offsetArg[]) {
+	if (recordArg->fieldCount > SQ_RECORD_FIELDS_MAX) {
+		return 0;
+	}
+	uint8_t offset = SQ_RECORD_PAYLOAD_INDEX;
+	for (uint8_t index = 0; index < recordArg->fieldCount; index++) {
+		uint8_t size = lexicon[recordArg->fieldIdPtr[index]].size;
+		uint8_t align = size < 4 ? size : 4;
+		if (align > 1) {
+			offset = (offset + align - 1) / align * align;
+		}
+		offsetArg[index] = offset;
+		offset += size;
+	}
+	return (offset + 3) / 4 * 4;
+}
+
+/**
+ * @brief number of packet slots a record takes in the active format
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @retval packet slots, 0 for ids of another datatype than record
+ */
+uint8_t spiRecordSlots(uint8_t identifierArg) {
+	int16_t index = spiRecordFind(identifierArg);
+	if (index < 0) {
+		return 0;
+	}
+	uint8_t offset[SQ_RECORD_FIELDS_MAX];
+	uint8_t crcIndex = spiRecordLayout(&spiRecords[index], offset);
+	if (crcIndex == 0) {
+		return 0;
+	}
+	return (crcIndex + SQ_CRC_SIZE + spiFormatActive->packetSize - 1) / spiFormatActive->packetSize;
+}
+
+/**
+ * @brief encodes a record with all its fields in one go
+ * @param[out] arrayArg room for sq_record_size_max bytes
+ * @param[in] identifierArg a predefined id of datatype record
+ * @param[in] valuesArg value of every field in declared order, truncated for integer datatypes
+ * @retval bytes taken by the record, a whole number of packet slots of the active format, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - the record is either encoded as a whole or the failure is returned, a receiver never sees a partial update
+ */
+int16_t spiRecordEncode(uint8_t arrayArg[], uint8_t identifierArg, const double valuesArg[]) {
+	int16_t index = spiRecordFind(identifierArg);
+	if (index < 0) {
+		errorCatcher(ec_sq_bad_id);
+		return -1;
+	}
+	const struct structSpiRecord* record = &spiRecords[index];
+	uint8_t offset[SQ_RECORD_FIELDS_MAX];
+	uint8_t crcIndex = spiRecordLayout(record, offset);
+	uint16_t size = spiRecordSlots(identifierArg) * spiFormatActive->packetSize;
+	if (crcIndex == 0 || size > SQ_RECORD_SIZE_MAX) {
+		errorCatcher(ec_sq_record_bad);
+		return -1;
+	}
+	memset(arrayArg, 0, size);
+	arrayArg[SQ_ID_INDEX] = identifierArg;
+	arrayArg[SQ_RECORD_VERSION_INDEX] = record->version;
+	for (uint8_t field = 0; field < record->fieldCount; field++) {
+		if (spiQueueEncodeValue(arrayArg + offset[field], spiQueueFindType(record->fieldIdPtr[field]), valuesArg[field]) != 0) {
+			return -1;
+		}
+	}
+	union unionCrc crc;
+	crc.uint16 = GETCRCSIZE(arrayArg, crcIndex);
+	memcpy(arrayArg + crcIndex, crc.uint8, SQ_CRC_SIZE);
+	return size;
+}
+
+/**
+ * @brief decodes every field of a received record
+ * @param[in] recordArg record in wire layout, spirecordslots() packet slots of the active format
+ * @param[out] identifierArg room for sq_record_fields_max field ids
+ * @param[out] valuesArg room for sq_record_fields_max payloads, read the member matching the lexicon datatype of the field id
+ * @retval number of fields, -1 when the record is unknown, of another version or its crc does not match
+ */
+int16_t spiRecordDecode(uint8_t recordArg[], uint8_t identifierArg[], union unionPayload valuesArg[]) {
+	int16_t index = spiRecordFind(recordArg[SQ_ID_INDEX]);
+	if (index < 0 || recordArg[SQ_RECORD_VERSION_INDEX] != spiRecords[index].version) {
+		return -1;
+	}
+	const struct structSpiRecord* record = &spiRecords[index];
+	uint8_t offset[SQ_RECORD_FIELDS_MAX];
+	uint8_t crcIndex = spiRecordLayout(record, offset);
+	if (crcIndex == 0) {
+		return -1;
+	}
+	union unionCrc crc;
+	memcpy(crc.uint8, recordArg + crcIndex, SQ_CRC_SIZE);
+	if (crc.uint16 != (uint16_t)GETCRCSIZE(recordArg, crcIndex)) {
+		return -1;
+	}
+	for (uint8_t field = 0; field < record->fieldCount; field++) {
+		identifierArg[field] = record->fieldIdPtr[field];
+		memset(&valuesArg[field], 0, sizeof(valuesArg[field]));
+		memcpy(valuesArg[field].uint8, recordArg + offset[field], lexicon[record->fieldIdPtr[field]].size);
+	}
+	return record->fieldCount;
+}
+
+/**
+ * @brief encodes a record into the spirecordbox, replacing the record with the same id that is still waiting
+ * @param[in] structSpiRecordBoxPtrArg pointer to the structspirecordbox instance
+ * @param[in] identifierArg a predefined id of datatype record
+ * @param[in] valuesArg value of every field in declared order, truncated for integer datatypes
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - a failed encode leaves the waiting record untouched
+ */
+int8_t spiRecordPost(struct structSpiRecordBox* structSpiRecordBoxPtrArg, uint8_t identifierArg, const double valuesArg[]) {
+	// check if spirecordbox exists
+	if (structSpiRecordBoxPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist_post);
+		return -1;
+	}
+	uint8_t arrayTemp[SQ_RECORD_SIZE_MAX];
+	int16_t size = spiRecordEncode(arrayTemp, identifierArg, valuesArg);
+	if (size < 0) {
+		return -1;
+	}
+	int16_t index = spiRecordFind(identifierArg);
+	memcpy(structSpiRecordBoxPtrArg->record[index], arrayTemp, size);
+	structSpiRecordBoxPtrArg->slots[index] = size / spiFormatActive->packetSize;
+	if (structSpiRecordBoxPtrArg->pending[index]) {
+		structSpiRecordBoxPtrArg->overwriteCount++;
+		return 0;
+	}
+	structSpiRecordBoxPtrArg->pending[index] = true;
+	structSpiRecordBoxPtrArg->pendingCount++;
+	// only the first record wakes the consumer, like the first post into an empty spiqueue
+	if (structSpiRecordBoxPtrArg->pendingCount == 1 && structSpiRecordBoxPtrArg->consumerTaskPtr != NULL && structSpiRecordBoxPtrArg->consumerTaskPtr != SQ_TASK()) {
+		SQ_NOTIFY(structSpiRecordBoxPtrArg->consumerTaskPtr);
+	}
+	return 0;
+}
+
+/**
+ * @brief moves the waiting records that fit into maxslotsarg packet slots into one contiguous array
+ * @param[in] structSpiRecordBoxPtrArg pointer to the structspirecordbox instance
+ * @param[out] arrayArg[] pointer to array of maxslotsarg packet slots of the active format
+ * @param[in] maxSlotsArg packet slots available in arrayarg
+ * @retval number of packet slots filled, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - a record is moved whole or stays waiting, records that take more than maxslotsarg slots never leave
+ */
+int16_t spiRecordGet(struct structSpiRecordBox* structSpiRecordBoxPtrArg, uint8_t arrayArg[], uint8_t maxSlotsArg) {
+	// check if spirecordbox exists
+	if (structSpiRecordBoxPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	uint8_t slots = 0;
+	for (uint8_t index = 0; index < SQ_RECORDS_COUNT && structSpiRecordBoxPtrArg->pendingCount > 0; index++) {
+		if (!structSpiRecordBoxPtrArg->pending[index] || slots + structSpiRecordBoxPtrArg->slots[index] > maxSlotsArg) {
+			continue;
+		}
+		memcpy(arrayArg + slots * spiFormatActive->packetSize, structSpiRecordBoxPtrArg->record[index], structSpiRecordBoxPtrArg->slots[index] * spiFormatActive->packetSize);
+		slots += structSpiRecordBoxPtrArg->slots[index];
+		structSpiRecordBoxPtrArg->pending[index] = false;
+		structSpiRecordBoxPtrArg->pendingCount--;
+	}
+	return slots;
+}
+
+// SPIFIXED -----------------------------------------------------------------------------------------------------------------
+
+/** @brief structure definition for a fixed-point pair */
+struct structSpiPair {
+	uint8_t identifier; /**< lexicon id of datatype fixed */
+	uint8_t halfId[2];	/**< lexicon ids whose scale and offset apply to the two halves */
+};
+
+/** @brief turns a pair row into the pair at the next index */
+#define SQ_PAIRS_ENTRY(NAME, FIRST, SECOND) {NAME, {FIRST, SECOND}},
+
+/** @brief fixed-point pairs */
+static const struct structSpiPair spiPairs[] = {SQ_PAIRS(SQ_PAIRS_ENTRY)};
+
+/**
+ * @brief find the pair for the specified id
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @retval pair, null for ids of another datatype than fixed
+ */
+static const struct structSpiPair* spiFixedFind(uint8_t identifierArg) {
+	if (lexicon[identifierArg].dataType != FIXED) {
+		return NULL;
+	}
+	for (uint8_t index = 0; index < arraysize(spiPairs); index++) {
+		if (spiPairs[index].identifier == identifierArg) {
+			return &spiPairs[index];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief scales a value into a fixed-point count using the scale and offset of its lexicon row
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @param[in] milliValueArg value in thousandths of the unit of the lexicon row
+ * @param[out] countArg fixed-point count, rounded half away from zero
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - integer arithmetic only, the cortex-m33 has no double precision unit
+ */
+int8_t spiFixedEncode(uint8_t identifierArg, int64_t milliValueArg, int32_t* countArg) {
+	if (lexicon[identifierArg].dataType == X) {
+		errorCatcher(ec_sq_bad_id);
+		return -1;
+	}
+	// values this far out never fit a count, rejecting them first keeps the subtraction below from overflowing
+	if (milliValueArg > INT64_MAX / 2 || milliValueArg < INT64_MIN / 2) {
+		errorCatcher(ec_sq_payload_out_of_range_fixed);
+		return -1;
+	}
+	int64_t scale = lexicon[identifierArg].scale;
+	int64_t shifted = milliValueArg - lexicon[identifierArg].offset;
+	int64_t count = (shifted >= 0 ? shifted + scale / 2 : shifted - scale / 2) / scale;
+	if (count < INT32_MIN || count > INT32_MAX) {
+		errorCatcher(ec_sq_payload_out_of_range_fixed);
+		return -1;
+	}
+	*countArg = (int32_t)count;
+	return 0;
+}
+
+/**
+ * @brief scales a fixed-point count back into a value using the scale and offset of its lexicon row
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @param[in] countArg fixed-point count
+ * @retval value in thousandths of the unit of the lexicon row
+ */
+int64_t spiFixedDecode(uint8_t identifierArg, int32_t countArg) {
+	return (int64_t)countArg * lexicon[identifierArg].scale + lexicon[identifierArg].offset;
+}
+
+/**
+ * @brief create a packet carrying two values as one fixed-point pair
+ * @param[in] structSpiQueuePtrArg pointer to the structspiqueue instance
+ * @param[in] identifierArg a predefined id of datatype fixed
+ * @param[in] firstArg value of the first half in thousandths of its unit
+ * @param[in] secondArg value of the second half in thousandths of its unit
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - both halves are scaled before anything is posted, a receiver never sees one half updated without the other
+ */
+int8_t spiFixedPost(struct structSpiQueue* structSpiQueuePtrArg, uint8_t identifierArg, int64_t firstArg, int64_t secondArg) {
+	const struct structSpiPair* pair = spiFixedFind(identifierArg);
+	if (pair == NULL) {
+		errorCatcher(ec_sq_bad_id);
+	}
+	int32_t count[2];
+	if (pair == NULL || spiFixedEncode(pair->halfId[0], firstArg, &count[0]) != 0 || spiFixedEncode(pair->halfId[1], secondArg, &count[1]) != 0) {
+		if (structSpiQueuePtrArg != NULL) {
+			structSpiQueuePtrArg->metrics.drops[SQ_DROP_ENCODE]++;
+		}
+		return -1;
+	}
+	// create temporary frame and set id
+	uint8_t arrayTemp[SQ_SLOT_SIZE] = {0};
+	arrayTemp[SQ_ID_INDEX] = identifierArg;
+	memcpy(arrayTemp + spiFormatActive->payloadIndex, count, sizeof(count));
+	// fill crc fields
+	union unionCrc crc;
+	crc.uint16 = GETCRC(arrayTemp);
+	memcpy(arrayTemp + spiFormatActive->crcIndex, crc.uint8, SQ_CRC_SIZE);
+	// create packet from arraytemp
+	return spiQueuePostArray(structSpiQueuePtrArg, arrayTemp, spiFormatActive->packetSize, false);
+}
+
+/**
+ * @brief decodes both halves of a fixed-point pair frame in wire layout
+ * @param[in] frameArg frame in wire layout
+ * @param[out] identifierArg room for the two lexicon ids of the halves
+ * @param[out] valuesArg room for the two values in thousandths of their unit
+ * @retval 0 on success, -1 for frames of another datatype than fixed
+ */
+int8_t spiFixedGet(const uint8_t frameArg[], uint8_t identifierArg[], int64_t valuesArg[]) {
+	const struct structSpiPair* pair = spiFixedFind(spiFrameGetId(frameArg));
+	if (pair == NULL) {
+		return -1;
+	}
+	int32_t count[2];
+	memcpy(count, frameArg + spiFormatActive->payloadIndex, sizeof(count));
+	for (uint8_t half = 0; half < 2; half++) {
+		identifierArg[half] = pair->halfId[half];
+		valuesArg[half] = spiFixedDecode(pair->halfId[half], count[half]);
+	}
+	return 0;
+}
+
+// SPIWINDOW ----------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief allocates memory and initialises a spiwindow according to the structspiwindow layout
+ * @param[in] structSpiWindowPtrArg double pointer to the spiwindow pointer
+ * @param[in] timeoutArg ticks without an ack before a frame is resent, in the unit of the tickarg handed to the other calls
+ * @param[in] triesMaxArg transmissions before a frame is given up, at least 1
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - not isr safe, create the spiwindow during init
+ */
+int8_t spiWindowCreate(struct structSpiWindow** structSpiWindowPtrArg, uint32_t timeoutArg, uint8_t triesMaxArg) {
+	// check if spiwindow already exists
+	if (*structSpiWindowPtrArg != NULL) {
+		errorCatcher(ec_sq_already_exist);
+		return -1;
+	}
+	// a window without a timeout would resend every frame in the transaction after it
+	if (timeoutArg == 0 || triesMaxArg == 0) {
+		errorCatcher(ec_sq_window_bad);
+		return -1;
+	}
+	// calloc leaves every entry free and every counter at zero
+	struct structSpiWindow* newStructSpiWindow = calloc(1, sizeof(struct structSpiWindow));
+	// check if calloc was successful
+	if (newStructSpiWindow == NULL) {
+		errorCatcher(ec_sq_malloc_failed);
+		return -1;
+	}
+	newStructSpiWindow->timeout = timeoutArg;
+	newStructSpiWindow->triesMax = triesMaxArg;
+	// set address of calloced spiwindow to argument pointer
+	*structSpiWindowPtrArg = newStructSpiWindow;
+	return 0;
+}
+
+/**
+ * @brief removes the spiwindow and every entry still awaiting an ack
+ * @param[in] structSpiWindowPtrArg double pointer to the spiwindow pointer
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ */
+int8_t spiWindowRemove(struct structSpiWindow** structSpiWindowPtrArg) {
+	// check if ptr is not zero
+	if (*structSpiWindowPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	free(*structSpiWindowPtrArg);
+	// zero the address
+	*structSpiWindowPtrArg = NULL;
+	return 0;
+}
+
+/**
+ * @brief decodes the crc of a frame or record in wire layout
+ * @param[in] arrayArg frame or record in wire layout
+ * @param[in] slotsArg packet slots of a record as given by spirecordslots(), 0 for a frame
+ * @retval crc value
+ */
+static uint16_t spiWindowCrc(const uint8_t arrayArg[], uint8_t slotsArg) {
+	if (slotsArg == 0) {
+		return spiFrameGetCrc(arrayArg);
+	}
+	uint8_t offset[SQ_RECORD_FIELDS_MAX];
+	union unionCrc crc;
+	memcpy(crc.uint8, arrayArg + spiRecordLayout(&spiRecords[spiRecordFind(spiFrameGetId(arrayArg))], offset), SQ_CRC_SIZE);
+	return crc.uint16;
+}
+
+/**
+ * @brief frees the entry at the index
+ * @param[in] structSpiWindowPtrArg pointer to the structspiwindow instance
+ * @param[in] indexArg entry index
+ */
+static void spiWindowFree(struct structSpiWindow* structSpiWindowPtrArg, uint8_t indexArg) {
+	structSpiWindowPtrArg->entry[indexArg].slots = 0;
+	structSpiWindowPtrArg->count--;
+}
+
+/**
+ * @brief keeps a copy of a frame or record until the other side acks it
+ * @param[in] structSpiWindowPtrArg pointer to the structspiwindow instance
+ * @param[in] arrayArg frame or record in wire layout, as it goes out
+ * @param[in] slotsArg packet slots taken by arrayarg
+ * @param[in] tickArg current tick
+ * @note - fillers only carry acks and a crc of 0 can't be told apart from no ack, neither is kept
+ * @note - an unacked frame of the same id is replaced, resending it would undo the newer value on the other side
+ */
+static void spiWindowTrack(struct structSpiWindow* structSpiWindowPtrArg, uint8_t arrayArg[], uint8_t slotsArg, uint32_t tickArg) {
+	uint8_t identifier = spiFrameGetId(arrayArg);
+	uint16_t crc = spiWindowCrc(arrayArg, spiRecordSlots(identifier));
+	if (identifier == ID_FILLER || crc == 0) {
+		return;
+	}
+	int16_t vacant = -1;
+	uint8_t oldest = 0;
+	for (uint8_t index = 0; index < SQ_WINDOW_SIZE; index++) {
+		struct structSpiWindowEntry* entry = &structSpiWindowPtrArg->entry[index];
+		if (entry->slots == 0) {
+			vacant = vacant < 0 ? index : vacant;
+			continue;
+		}
+		if (spiFrameGetId(entry->array) == identifier) {
+			spiWindowFree(structSpiWindowPtrArg, index);
+			structSpiWindowPtrArg->metrics.superseded++;
+			vacant = index;
+			break;
+		}
+		if ((uint32_t)(tickArg - entry->sentTick) > (uint32_t)(tickArg - structSpiWindowPtrArg->entry[oldest].sentTick)) {
+			oldest = index;
+		}
+	}
+	// a full window gives up its oldest entry instead of holding back new frames
+	if (vacant < 0) {
+		spiWindowFree(structSpiWindowPtrArg, oldest);
+		structSpiWindowPtrArg->metrics.expired++;
+		vacant = oldest;
+	}
+	struct structSpiWindowEntry* entry = &structSpiWindowPtrArg->entry[vacant];
+	entry->slots = slotsArg;
+	entry->tries = 1;
+	entry->crc = crc;
+	entry->sentTick = tickArg;
+	memcpy(entry->array, arrayArg, slotsArg * spiFormatActive->packetSize);
+	structSpiWindowPtrArg->count++;
+	structSpiWindowPtrArg->metrics.tracked++;
+}
+
+/**
+ * @brief writes the oldest waiting ack into the ack field of a frame
+ * @param[in] structSpiWindowPtrArg pointer to the structspiwindow instance
+ * @param[in] frameArg frame in wire layout, word aligned when the hardware crc is used
+ * @note - the crc covers the ack field and is calculated again, a frame with an ack field in use is left alone
+ */
+static void spiWindowAckPlace(struct structSpiWindow* structSpiWindowPtrArg, uint8_t frameArg[]) {
+	if (structSpiWindowPtrArg->ackCount == 0 || spiFrameGetAck(frameArg) != 0) {
+		return;
+	}
+	union unionCrc ack;
+	ack.uint16 = structSpiWindowPtrArg->ack[0];
+	memcpy(frameArg + spiFormatActive->ackIndex, ack.uint8, SQ_ACK_SIZE);
+	structSpiWindowPtrArg->ackCount--;
+	memmove(structSpiWindowPtrArg->ack, structSpiWindowPtrArg->ack + 1, structSpiWindowPtrArg->ackCount * sizeof(structSpiWindowPtrArg->ack[0]));
+	union unionCrc crc;
+	crc.uint16 = GETCRC(frameArg);
+	memcpy(frameArg + spiFormatActive->crcIndex, crc.uint8, SQ_CRC_SIZE);
+}
+
+/**
+ * @brief hands the waiting acks to newly encoded frames and keeps those frames until they are acked
+ * @param[in] structSpiWindowPtrArg pointer to the structspiwindow instance
+ * @param[in,out] arrayArg[] frames and records as they come from spirecordget() and spiqueuegetburst(), room for maxslotsarg packet slots
+ * @param[in] slotsArg packet slots filled in arrayarg
+ * @param[in] maxSlotsArg packet slots available in arrayarg
+ * @param[in] tickArg current tick
+ * @retval packet slots filled in arrayarg, fillers carrying acks included, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - acks no frame has room for go out in fillers behind the frames while there are free slots
+ * @note - leave frames from spiwindowresend() out of arrayarg, a new ack would change the crc the other side echoes
+ */
+int16_t spiWindowSend(struct structSpiWindow* structSpiWindowPtrArg, uint8_t arrayArg[], uint8_t slotsArg, uint8_t maxSlotsArg, uint32_t tickArg) {
+	// check if spiwindow exists
+	if (structSpiWindowPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	uint8_t packetSize = spiFormatActive->packetSize;
+	for (uint8_t index = 0; index < slotsArg;) {
+		uint8_t* frame = arrayArg + index * packetSize;
+		uint8_t slots = spiRecordSlots(spiFrameGetId(frame));
+		// records have no ack field
+		if (slots == 0) {
+			spiWindowAckPlace(structSpiWindowPtrArg, frame);
+			slots = 1;
+		}
+		spiWindowTrack(structSpiWindowPtrArg, frame, slots, tickArg);
+		index += slots;
+	}
+	for (; structSpiWindowPtrArg->ackCount > 0 && slotsArg < maxSlotsArg; slotsArg++) {
+		uint8_t* frame = arrayArg + slotsArg * packetSize;
+		memset(frame, 0, packetSize);
+		frame[SQ_ID_INDEX] = ID_FILLER;
+		spiWindowAckPlace(structSpiWindowPtrArg, frame);
+	}
+	return slotsArg;
+}
+
+/**
+ * @brief copies the frames and records whose ack did not come in time into a transmit array
+ * @param[in] structSpiWindowPtrArg pointer to the structspiwindow instance
+ * @param[out] arrayArg[] room for maxslotsarg packet slots
+ * @param[in] maxSlotsArg packet slots available in arrayarg
+ * @param[in] tickArg current tick
+ * @retval packet slots filled, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - entries go out byte for byte as before, so an ack of any transmission frees them
+ * @note - entries that went out triesmax times are given up, an entry that does not fit waits for the next call
+ */
+int16_t spiWindowResend(struct structSpiWindow* structSpiWindowPtrArg, uint8_t arrayArg[], uint8_t maxSlotsArg, uint32_t tickArg) {
+	// check if spiwindow exists
+	if (structSpiWindowPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	uint8_t slots = 0;
+	for (uint8_t index = 0; index < SQ_WINDOW_SIZE && structSpiWindowPtrArg->count > 0; index++) {
+		struct structSpiWindowEntry* entry = &structSpiWindowPtrArg->entry[index];
+		if (entry->slots == 0 || (uint32_t)(tickArg - entry->sentTick) < structSpiWindowPtrArg->timeout) {
+			continue;
+		}
+		if (entry->tries >= structSpiWindowPtrArg->triesMax) {
+			spiWindowFree(structSpiWindowPtrArg, index);
+			structSpiWindowPtrArg->metrics.expired++;
+			continue;
+		}
+		if (slots + entry->slots > maxSlotsArg) {
+			continue;
+		}
+		memcpy(arrayArg + slots * spiFormatActive->packetSize, entry->array, entry->slots * spiFormatActive->packetSize);
+		slots += entry->slots;
+		entry->tries++;
+		entry->sentTick = tickArg;
+		structSpiWindowPtrArg->metrics.resent++;
+	}
+	return slots;
+}
+
+/**
+ * @brief frees the entry acked by a received frame and remembers the crc of the frame to echo it
+ * @param[in] structSpiWindowPtrArg pointer to the structspiwindow instance
+ * @param[in] arrayArg[] frame or record in wire layout whose crc was checked
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - fillers are not echoed, two sides acking each other's fillers would never run out of frames to send
+ * @note - call it for duplicates as well, the other side resends a frame until one of its acks comes through
+ */
+int8_t spiWindowReceive(struct structSpiWindow* structSpiWindowPtrArg, uint8_t arrayArg[]) {
+	// check if spiwindow exists
+	if (structSpiWindowPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	uint8_t identifier = spiFrameGetId(arrayArg);
+	uint8_t slots = spiRecordSlots(identifier);
+	uint16_t ack = slots == 0 ? spiFrameGetAck(arrayArg) : 0;
+	for (uint8_t index = 0; index < SQ_WINDOW_SIZE && ack != 0; index++) {
+		if (structSpiWindowPtrArg->entry[index].slots != 0 && structSpiWindowPtrArg->entry[index].crc == ack) {
+			spiWindowFree(structSpiWindowPtrArg, index);
+			structSpiWindowPtrArg->metrics.acked++;
+			break;
+		}
+	}
+	uint16_t crc = spiWindowCrc(arrayArg, slots);
+	if (identifier == ID_FILLER || crc == 0) {
+		return 0;
+	}
+	for (uint8_t index = 0; index < structSpiWindowPtrArg->ackCount; index++) {
+		if (structSpiWindowPtrArg->ack[index] == crc) {
+			return 0;
+		}
+	}
+	// the oldest crc makes room, its frame comes again after the timeout of the other side
+	if (structSpiWindowPtrArg->ackCount == SQ_WINDOW_ACKS) {
+		structSpiWindowPtrArg->ackCount--;
+		memmove(structSpiWindowPtrArg->ack, structSpiWindowPtrArg->ack + 1, structSpiWindowPtrArg->ackCount * sizeof(structSpiWindowPtrArg->ack[0]));
+		structSpiWindowPtrArg->metrics.acksDropped++;
+	}
+	structSpiWindowPtrArg->ack[structSpiWindowPtrArg->ackCount++] = crc;
+	return 0;
+}
+
+// SPILINK ------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief byte index of the crc of a frame or record in wire layout
+ * @param[in] arrayArg frame or record in wire layout
+ * @param[in] slotsArg packet slots of a record as given by spirecordslots(), 0 for a frame
+ * @retval crc index, the crc covers every byte in front of it
+ */
+static uint8_t spiLinkCrcIndex(const uint8_t arrayArg[], uint8_t slotsArg) {
+	if (slotsArg == 0) {
+		return spiFormatActive->crcIndex;
+	}
+	uint8_t offset[SQ_RECORD_FIELDS_MAX];
+	return spiRecordLayout(&spiRecords[spiRecordFind(spiFrameGetId(arrayArg))], offset);
+}
+
+/**
+ * @brief moves the received history of a spilink along by a number of newer sequences
+ * @param[in] structSpiLinkPtrArg pointer to the structspilink instance
+ * @param[in] distanceArg sequences the newest one moves ahead, below sq_link_history
+ */
+static void spiLinkShift(struct structSpiLink* structSpiLinkPtrArg, uint8_t distanceArg) {
+	uint64_t* seen = structSpiLinkPtrArg->seen;
+	uint8_t words = distanceArg / 64;
+	uint8_t bits = distanceArg % 64;
+	// from the oldest word down, every word takes the bits of the words in front of it
+	for (int8_t word = SQ_LINK_HISTORY / 64 - 1; word >= 0; word--) {
+		uint64_t value = 0;
+		if (word >= words) {
+			value = seen[word - words] << bits;
+			if (bits > 0 && word > words) {
+				value |= seen[word - words - 1] >> (64 - bits);
+			}
+		}
+		seen[word] = value;
+	}
+}
+
+/**
+ * @brief stamps the next sequences into new frames and records
+ * @param[in] structSpiLinkPtrArg pointer to the structspilink instance
+ * @param[in,out] arrayArg[] frames and records as they come from spirecordget() and spiqueuegetburst()
+ * @param[in] slotsArg packet slots filled in arrayarg
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - the crc is calculated again, stamp before spiwindowsend() and leave resent frames alone
+ * @note - fillers take no sequence, formats without a sequence byte are left untouched
+ */
+int8_t spiLinkStamp(struct structSpiLink* structSpiLinkPtrArg, uint8_t arrayArg[], uint8_t slotsArg) {
+	// check if spilink exists
+	if (structSpiLinkPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	if (spiFormatActive->sequenceSize == 0) {
+		return 0;
+	}
+	for (uint8_t index = 0; index < slotsArg;) {
+		uint8_t* frame = arrayArg + index * spiFormatActive->packetSize;
+		uint8_t slots = spiRecordSlots(spiFrameGetId(frame));
+		if (spiFrameGetId(frame) != ID_FILLER) {
+			frame[slots == 0 ? spiFormatActive->sequenceIndex : SQ_RECORD_SEQUENCE_INDEX] = structSpiLinkPtrArg->sequenceNext++;
+			uint8_t crcIndex = spiLinkCrcIndex(frame, slots);
+			union unionCrc crc;
+			crc.uint16 = GETCRCSIZE(frame, crcIndex);
+			memcpy(frame + crcIndex, crc.uint8, SQ_CRC_SIZE);
+		}
+		index += slots > 0 ? slots : 1;
+	}
+	return 0;
+}
+
+/**
+ * @brief checks the crc and sequence of a received frame or record and counts it
+ * @param[in] structSpiLinkPtrArg pointer to the structspilink instance
+ * @param[in] arrayArg[] frame in wire layout or record spanning spirecordslots() packet slots
+ * @retval spilinkverdicts value, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - a value that repeats is new as long as its sequence is, only a sequence received before is a duplicate
+ * @note - a skipped sequence counts as lost until it comes late, then it counts as out of order instead
+ * @note - fillers and formats without a sequence byte only have their crc checked
+ */
+int8_t spiLinkReceive(struct structSpiLink* structSpiLinkPtrArg, uint8_t arrayArg[]) {
+	// check if spilink exists
+	if (structSpiLinkPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	struct structSpiLinkMetrics* metrics = &structSpiLinkPtrArg->metrics;
+	uint8_t identifier = spiFrameGetId(arrayArg);
+	uint8_t slots = spiRecordSlots(identifier);
+	uint8_t crcIndex = spiLinkCrcIndex(arrayArg, slots);
+	union unionCrc crc;
+	memcpy(crc.uint8, arrayArg + crcIndex, SQ_CRC_SIZE);
+	if (crc.uint16 != (uint16_t)GETCRCSIZE(arrayArg, crcIndex)) {
+		metrics->crcFailed++;
+		return SQ_LINK_CRC_FAILED;
+	}
+	metrics->received++;
+	if (spiFormatActive->sequenceSize == 0 || identifier == ID_FILLER) {
+		return SQ_LINK_NEW;
+	}
+	uint8_t sequence = arrayArg[slots == 0 ? spiFormatActive->sequenceIndex : SQ_RECORD_SEQUENCE_INDEX];
+	uint64_t* seen = structSpiLinkPtrArg->seen;
+	if (!structSpiLinkPtrArg->synced) {
+		structSpiLinkPtrArg->synced = true;
+		structSpiLinkPtrArg->sequenceNewest = sequence;
+		memset(seen, 0, sizeof(structSpiLinkPtrArg->seen));
+		seen[0] = 1;
+		return SQ_LINK_NEW;
+	}
+	// half the sequence space lies ahead of the newest sequence, the other half behind it
+	int8_t distance = (int8_t)(uint8_t)(sequence - structSpiLinkPtrArg->sequenceNewest);
+	if (distance > 0) {
+		metrics->lost += distance - 1;
+		spiLinkShift(structSpiLinkPtrArg, distance);
+		seen[0] |= 1;
+		structSpiLinkPtrArg->sequenceNewest = sequence;
+		return SQ_LINK_NEW;
+	}
+	uint8_t age = (uint8_t)(structSpiLinkPtrArg->sequenceNewest - sequence);
+	if (age >= SQ_LINK_HISTORY || (seen[age / 64] >> (age % 64)) & 1) {
+		metrics->duplicated++;
+		return SQ_LINK_DUPLICATE;
+	}
+	seen[age / 64] |= (uint64_t)1 << (age % 64);
+	metrics->outOfOrder++;
+	if (metrics->lost > 0) {
+		metrics->lost--;
+	}
+	return SQ_LINK_NEW;
+}
+
+// SPIFILTER ----------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief finds the slot of a filtered id
+ * @param[in] structSpiFilterPtrArg pointer to the structspifilter instance
+ * @param[in] identifierArg a predefined id recorded by the lexicon used to distinguish variables
+ * @retval slot index, -1 when the id was never sent
+ */
+static int16_t spiFilterFindSlot(const struct structSpiFilter* structSpiFilterPtrArg, uint8_t identifierArg) {
+	for (uint8_t slot = 0; slot < structSpiFilterPtrArg->slots; slot++) {
+		if (structSpiFilterPtrArg->identifier[slot] == identifierArg) {
+			return slot;
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief decides whether values about to be posted together differ enough from the last sent ones
+ * @param[in] structSpiFilterPtrArg pointer to the structspifilter instance
+ * @param[in] identifierArg ids of the values, their lexicon rows hold the deadband and refresh
+ * @param[in] valuesArg values about to be posted
+ * @param[in] countArg number of values, they go out together or not at all
+ * @param[in] tickArg current time in ms
+ * @retval 1 when the values are due, 0 when they are held back, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - the values are due once one of them moved beyond its deadband, reached its refresh or was never sent
+ * @note - ids with a refresh of 0 are not filtered, values including one are always due
+ * @note - due values stay due until spifiltersent() takes them as sent, a failed post is tried again next time
+ */
+int8_t spiFilterPass(struct structSpiFilter* structSpiFilterPtrArg, const uint8_t identifierArg[], const double valuesArg[], uint8_t countArg, uint32_t tickArg) {
+	// check if spifilter exists
+	if (structSpiFilterPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	bool due = false;
+	for (uint8_t index = 0; index < countArg && !due; index++) {
+		const struct structLexicon* entry = &lexicon[identifierArg[index]];
+		int16_t slot = spiFilterFindSlot(structSpiFilterPtrArg, identifierArg[index]);
+		if (entry->refresh == 0 || slot < 0) {
+			due = true;
+		} else {
+			double delta = valuesArg[index] - structSpiFilterPtrArg->value[slot];
+			delta = delta < 0 ? -delta : delta;
+			due = tickArg - structSpiFilterPtrArg->tick[slot] >= entry->refresh || delta * 1000 > entry->deadband;
+		}
+	}
+	if (!due) {
+		structSpiFilterPtrArg->metrics.held += countArg;
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief takes values as sent once their post succeeded
+ * @param[in] structSpiFilterPtrArg pointer to the structspifilter instance
+ * @param[in] identifierArg ids of the values, as given to spifilterpass()
+ * @param[in] valuesArg values that were posted
+ * @param[in] countArg number of values
+ * @param[in] tickArg current time in ms
+ * @retval 0 on success, -1 on failure
+ * @note - equipped with errorcatcher()
+ * @note - ids with a refresh of 0 take no slot
+ */
+int8_t spiFilterSent(struct structSpiFilter* structSpiFilterPtrArg, const uint8_t identifierArg[], const double valuesArg[], uint8_t countArg, uint32_t tickArg) {
+	// check if spifilter exists
+	if (structSpiFilterPtrArg == NULL) {
+		errorCatcher(ec_sq_doesnt_exist);
+		return -1;
+	}
+	for (uint8_t index = 0; index < countArg; index++) {
+		if (lexicon[identifierArg[index]].refresh == 0) {
+			continue;
+		}
+		int16_t slot = spiFilterFindSlot(structSpiFilterPtrArg, identifierArg[index]);
+		if (slot < 0) {
+			// every lexicon row with a refresh has a slot, so a free one is always left
+			slot = structSpiFilterPtrArg->slots++;
+			structSpiFilterPtrArg->identifier[slot] = identifierArg[index];
+		}
+		structSpiFilterPtrArg->value[slot] = valuesArg[index];
+		structSpiFilterPtrArg->tick[slot] = tickArg;
+	}
+	structSpiFilterPtrArg->metrics.passed += countArg;
+	return 0;
+}
+
+// SPIFRAME -----------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief decodes the identifier of a frame in wire layout
+ * @param[in] frameArg frame in wire layout
+ * @retval identifier
+ */
+uint8_t spiFrameGetId(const uint8_t frameArg[]) {
+	return frameArg[SQ_ID_INDEX];
+}
+
+/**
+ * @brief decodes the sequence byte of a frame in wire layout
+ * @param[in] frameArg frame in wire layout
+ * @retval sequence byte, 0 in formats without one
+ */
+uint8_t spiFrameGetSequence(const uint8_t frameArg[]) {
+	uint8_t sequence = 0;
+	memcpy(&sequence, frameArg + spiFormatActive->sequenceIndex, spiFormatActive->sequenceSize);
+	return sequence;
+}
+
+/**
+ * @brief decodes the payload of a frame in wire layout
+ * @param[in] frameArg frame in wire layout
+ * @retval payload union, read the member matching the lexicon datatype of the identifier
+ */
+union unionPayload spiFrameGetPayload(const uint8_t frameArg[]) {
+	union unionPayload payload;
+	memcpy(payload.uint8, frameArg + spiFormatActive->payloadIndex, SQ_PAYLOAD_SIZE);
+	return payload;
+}
+
+/**
+ * @brief decodes the ack field of a frame in wire layout
+ * @param[in] frameArg frame in wire layout
+ * @retval ack value
+ */
+uint16_t spiFrameGetAck(const uint8_t frameArg[]) {
+	union unionCrc ack;
+	memcpy(ack.uint8, frameArg + spiFormatActive->ackIndex, SQ_ACK_SIZE);
+	return ack.uint16;
+}
+
+/**
+ * @brief decodes the crc field of a frame in wire layout
+ * @param[in] frameArg frame in wire layout
+ * @retval crc value
+ */
+uint16_t spiFrameGetCrc(const uint8_t frameArg[]) {
+	union unionCrc crc;
+	memcpy(crc.uint8, frameArg + spiFormatActive->crcIndex, SQ_CRC_SIZE);
+	return crc.uint16;
+}
+
+/**
+ * @brief checks the crc field of a frame in wire layout against its contents
+ * @param[in] frameArg frame in wire layout, word aligned when the hardware crc is used
+ * @retval true when the crc matches
+ */
+bool spiFrameCrcGood(uint8_t frameArg[]) {
+	return spiFrameGetCrc(frameArg) == (uint16_t)GETCRC(frameArg);
+}
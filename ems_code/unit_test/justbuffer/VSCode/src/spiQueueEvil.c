@@ -21,8 +21,8 @@ int8_t spiQueueCreateEvil(struct structSpiQueue** structSpiQueuePtrArg, uint8_t
 		errorCatcher(ec_sq_already_exist);
 		return -1;
 	}
-	// malloc new spiqueue
-	struct structSpiQueue* newStructSpiQueue = EVILMALLOC(sizeof(struct structSpiQueue));
+	// malloc new spiqueue with its packet pool directly behind it
+	struct structSpiQueue* newStructSpiQueue = EVILMALLOC(SQ_POOL_OFFSET + sizeMaxArg * sizeof(struct structPacket));
 	// check if malloc was successful
 	if (newStructSpiQueue == NULL) {
 		errorCatcher(ec_sq_malloc_failed);
@@ -31,8 +31,28 @@ int8_t spiQueueCreateEvil(struct structSpiQueue** structSpiQueuePtrArg, uint8_t
 	// initialize spiqueue default fields
 	newStructSpiQueue->sizeCurrent = 0;
 	newStructSpiQueue->sizeMax = sizeMaxArg;
+	newStructSpiQueue->mode = SQ_MODE_FIFO;
+	newStructSpiQueue->scheduler = SQ_SCHEDULER_FIFO;
+	newStructSpiQueue->overflow = SQ_OVERFLOW_DROP_NEWEST;
+	newStructSpiQueue->timeout = 0;
+	newStructSpiQueue->waitingTaskPtr = NULL;
 	newStructSpiQueue->headPacketPtr = NULL;
 	newStructSpiQueue->tailPacketPtr = NULL;
+	// initialize empty priority classes
+	memset(newStructSpiQueue->classes, 0, sizeof(newStructSpiQueue->classes));
+	for (uint8_t priority = 0; priority < SQ_PRIO_CLASSES; priority++) {
+		newStructSpiQueue->classes[priority].weight = 1;
+		newStructSpiQueue->classes[priority].credit = 1;
+	}
+	// start with clean health counters
+	memset(&newStructSpiQueue->metrics, 0, sizeof(newStructSpiQueue->metrics));
+	// chain all pool packets into the free list
+	newStructSpiQueue->poolPacketPtr = (struct structPacket*)((uint8_t*)newStructSpiQueue + SQ_POOL_OFFSET);
+	newStructSpiQueue->freePacketPtr = NULL;
+	for (uint16_t index = sizeMaxArg; index > 0; index--) {
+		newStructSpiQueue->poolPacketPtr[index - 1].nextPacketPtr = newStructSpiQueue->freePacketPtr;
+		newStructSpiQueue->freePacketPtr = &newStructSpiQueue->poolPacketPtr[index - 1];
+	}
 	// set address of malloced spiqueue to argument pointer
 	*structSpiQueuePtrArg = newStructSpiQueue;
 	return 0;
@@ -48,9 +68,9 @@ int8_t spiQueueCreateEvil(struct structSpiQueue** structSpiQueuePtrArg, uint8_t
  * @note - equipped with errorcatcher()
  */
 static struct structPacket* spiQueuePacketAppendEvil(uint8_t arrayArg[]) {
-	// malloc new packet
+	// take packet from a pool that is always exhausted
 	struct structPacket* newPacket = EVILMALLOC(sizeof(struct structPacket));
-	// check if malloc was successful
+	// check if the pool was not exhausted
 	if (newPacket == NULL) {
 		errorCatcher(ec_sq_packet_malloc_failed);
 		return NULL;